@@ -0,0 +1,94 @@
+// Copyright (c) 2026 Kingsley Chen <kingsamchen at gmail dot com>
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "benchmark/benchmark.h"
+
+#include "esl/detail/strings_match.h"
+#include "esl/strings.h"
+
+namespace strings = esl::strings;
+
+namespace {
+
+// Header-like text mixing cases, digits and punctuations.
+std::string make_text(std::int64_t len) {
+    constexpr std::string_view pattern = "Content-Type: Text/HTML; Charset=UTF-8\r\n";
+    std::string text;
+    while (text.size() < static_cast<std::size_t>(len)) {
+        text.append(pattern);
+    }
+    text.resize(static_cast<std::size_t>(len));
+    return text;
+}
+
+void bm_to_lower_ascii_scalar(benchmark::State& state) {
+    const auto src = make_text(state.range(0));
+    std::string dest(src.size(), '\0');
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < src.size(); ++i) {
+            dest[i] = strings::detail::ascii_to_lower(src[i]);
+        }
+        benchmark::DoNotOptimize(dest.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void bm_to_lower_ascii(benchmark::State& state) {
+    const auto src = make_text(state.range(0));
+    std::string dest(src.size(), '\0');
+    for (auto _ : state) {
+        strings::to_lower_ascii(src, dest.data());
+        benchmark::DoNotOptimize(dest.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void bm_to_upper_ascii_scalar(benchmark::State& state) {
+    const auto src = make_text(state.range(0));
+    std::string dest(src.size(), '\0');
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < src.size(); ++i) {
+            dest[i] = strings::detail::ascii_to_upper(src[i]);
+        }
+        benchmark::DoNotOptimize(dest.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void bm_to_upper_ascii(benchmark::State& state) {
+    const auto src = make_text(state.range(0));
+    std::string dest(src.size(), '\0');
+    for (auto _ : state) {
+        strings::to_upper_ascii(src, dest.data());
+        benchmark::DoNotOptimize(dest.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void bm_to_lower_ascii_inplace(benchmark::State& state) {
+    auto text = make_text(state.range(0));
+    for (auto _ : state) {
+        strings::to_lower_ascii_inplace(text);
+        benchmark::DoNotOptimize(text.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(bm_to_lower_ascii_scalar)->RangeMultiplier(8)->Range(16, 1 << 20);
+BENCHMARK(bm_to_lower_ascii)->RangeMultiplier(8)->Range(16, 1 << 20);
+BENCHMARK(bm_to_upper_ascii_scalar)->RangeMultiplier(8)->Range(16, 1 << 20);
+BENCHMARK(bm_to_upper_ascii)->RangeMultiplier(8)->Range(16, 1 << 20);
+BENCHMARK(bm_to_lower_ascii_inplace)->RangeMultiplier(8)->Range(16, 1 << 20);
+
+} // namespace
@@ -0,0 +1,130 @@
+// Copyright (c) 2026 Kingsley Chen <kingsamchen at gmail dot com>
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "esl/csv.h"
+#include "esl/strings.h"
+
+namespace strings = esl::strings;
+
+namespace {
+
+// Records of `len` bytes in total, where about one record in `quoted_every` has quoted fields
+// with separators, escaped quotes and newlines within.
+std::string make_csv(std::int64_t len, std::int64_t quoted_every) {
+    constexpr std::string_view plain = "1024,kingsley,3.1415926,2026-01-01,header-only,42\n";
+    constexpr std::string_view quoted =
+            "2048,\"chen, kingsley\",2.71828,2026-01-02,\"say \"\"hi\"\"\",\"multi\nline\"\r\n";
+    std::string text;
+    for (std::int64_t i = 0; text.size() < static_cast<std::size_t>(len); ++i) {
+        text.append(i % quoted_every == 0 ? quoted : plain);
+    }
+    return text;
+}
+
+// The byte-by-byte state machine that the tokenizer replaces.
+std::size_t count_fields_bytewise(std::string_view text) {
+    std::size_t count{0};
+    bool in_quotes{false};
+    for (const char ch : text) {
+        if (ch == '"') {
+            in_quotes = !in_quotes;
+        } else if (!in_quotes && (ch == ',' || ch == '\n')) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+void bm_csv_bytewise(benchmark::State& state) {
+    const auto text = make_csv(state.range(0), state.range(1));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(count_fields_bytewise(text));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void bm_csv_tokenize(benchmark::State& state) {
+    const auto text = make_csv(state.range(0), state.range(1));
+    for (auto _ : state) {
+        std::size_t count{0};
+        strings::for_each_csv_field(text, [&count](const auto& field, bool) {
+            count += field.raw.size();
+            return true;
+        });
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void bm_csv_tokenize_records(benchmark::State& state) {
+    const auto text = make_csv(state.range(0), state.range(1));
+    for (auto _ : state) {
+        std::size_t count{0};
+        strings::for_each_csv_record(text, [&count](const auto& fields) {
+            count += fields.size();
+            return true;
+        });
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+// Converting fields through temporary strings into the same columns as `bm_csv_load`, which
+// the loader replaces.
+void bm_csv_convert_by_stod(benchmark::State& state) {
+    const auto text = make_csv(state.range(0), state.range(1));
+    for (auto _ : state) {
+        std::vector<std::int64_t> ids;
+        std::vector<double> values;
+        std::vector<std::string_view> strs[4];
+        std::size_t column{0};
+        strings::for_each_csv_field(text, [&](const auto& field, bool record_end) {
+            if (column == 0) {
+                ids.push_back(std::stoll(field.value()));
+            } else if (column == 2) {
+                values.push_back(std::stod(field.value()));
+            } else if (column < 6) {
+                strs[column == 1 ? 0 : column - 2].push_back(field.raw);
+            }
+            column = record_end ? 0 : column + 1;
+            return true;
+        });
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void bm_csv_load(benchmark::State& state) {
+    const auto text = make_csv(state.range(0), state.range(1));
+    const std::vector<esl::csv_type> schema{
+            esl::csv_type::int64,  esl::csv_type::string, esl::csv_type::float64,
+            esl::csv_type::string, esl::csv_type::string, esl::csv_type::string};
+    esl::csv_load_options options;
+    options.threads = static_cast<std::size_t>(state.range(2));
+    for (auto _ : state) {
+        auto table = esl::load_csv(text, schema, options);
+        benchmark::DoNotOptimize(table.rows());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+// 256 MiB of text, as read from a file by `read_file_to_string()`.
+constexpr std::int64_t csv_size = std::int64_t{1} << 28;
+
+BENCHMARK(bm_csv_bytewise)->Args({csv_size, 1})->Args({csv_size, 16});
+BENCHMARK(bm_csv_tokenize)->Args({csv_size, 1})->Args({csv_size, 16});
+BENCHMARK(bm_csv_tokenize_records)->Args({csv_size, 16});
+BENCHMARK(bm_csv_convert_by_stod)->Args({csv_size, 16});
+BENCHMARK(bm_csv_load)->Args({csv_size, 16, 1})->Args({csv_size, 16, 4});
+
+} // namespace
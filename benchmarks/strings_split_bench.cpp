@@ -0,0 +1,167 @@
+// Copyright (c) 2026 Kingsley Chen <kingsamchen at gmail dot com>
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "esl/small_vector.h"
+#include "esl/strings.h"
+
+namespace strings = esl::strings;
+
+namespace {
+
+constexpr std::size_t field_width = 4;
+
+// `count` comma-separated fields taking `field_width` bytes each, delimiter included, so that
+// splitting by ',' and by length yields the same number of fields.
+std::string make_fields(std::int64_t count) {
+    std::string text;
+    for (std::int64_t i = 0; i < count; ++i) {
+        text.append("abc,");
+    }
+    text.pop_back();
+    return text;
+}
+
+template<typename Container>
+void bm_split_by_char(benchmark::State& state) {
+    const auto text = make_fields(state.range(0));
+    for (auto _ : state) {
+        auto fields = strings::split(text, ',').to<Container>();
+        benchmark::DoNotOptimize(fields.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// `by_length` has no bulk scanning, and goes through 16-element batching for vectors.
+template<typename Container>
+void bm_split_by_length(benchmark::State& state) {
+    const auto text = make_fields(state.range(0));
+    for (auto _ : state) {
+        auto fields = strings::split(text, strings::by_length(field_width)).to<Container>();
+        benchmark::DoNotOptimize(fields.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Log-like lines of varying lengths.
+std::string make_lines(std::int64_t len) {
+    constexpr std::string_view lines[] = {
+            "2026-01-01 00:00:00 INFO request served\n",
+            "2026-01-01 00:00:01 WARN slow upstream response, retrying\n",
+            "ok\n",
+    };
+    std::string text;
+    for (std::size_t i = 0; text.size() < static_cast<std::size_t>(len); ++i) {
+        text.append(lines[i % std::size(lines)]);
+    }
+    return text;
+}
+
+void bm_split_lines(benchmark::State& state) {
+    const auto text = make_lines(state.range(0));
+    for (auto _ : state) {
+        auto lines = strings::split(text, '\n').to<std::vector<std::string_view>>();
+        benchmark::DoNotOptimize(lines.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void bm_parallel_split_lines(benchmark::State& state) {
+    const auto text = make_lines(state.range(0));
+    const strings::parallel_split_options options{static_cast<std::size_t>(state.range(1))};
+    for (auto _ : state) {
+        auto lines = strings::parallel_split(text, '\n', options);
+        benchmark::DoNotOptimize(lines.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+// Whitespace-padded CSV-like records.
+std::string make_padded_fields(std::int64_t count) {
+    std::string text;
+    for (std::int64_t i = 0; i < count; ++i) {
+        text.append(i % 2 == 0 ? " 42 ,\t" : "alpha beta\t, ");
+    }
+    return text;
+}
+
+void bm_split_then_trim(benchmark::State& state) {
+    const auto text = make_padded_fields(state.range(0));
+    std::vector<std::string_view> fields;
+    for (auto _ : state) {
+        fields.clear();
+        for (const auto field : strings::split(text, ',')) {
+            fields.push_back(strings::trim(field, " \t"));
+        }
+        benchmark::DoNotOptimize(fields.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void bm_split_trim_fused(benchmark::State& state) {
+    const auto text = make_padded_fields(state.range(0));
+    std::vector<std::string_view> fields;
+    for (auto _ : state) {
+        strings::split(text, ',', strings::trim_fields(" \t")).into(fields);
+        benchmark::DoNotOptimize(fields.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Column-aligned text with runs of whitespaces.
+std::string make_aligned_text(std::int64_t len) {
+    constexpr std::string_view line = "    name        esl       \t\tkind    header-only\r\n";
+    std::string text;
+    while (text.size() < static_cast<std::size_t>(len)) {
+        text.append(line);
+    }
+    text.resize(static_cast<std::size_t>(len));
+    return text;
+}
+
+void bm_split_whitespace_by_any_char(benchmark::State& state) {
+    const auto text = make_aligned_text(state.range(0));
+    const strings::by_any_char delim(" \t\r\n");
+    std::vector<std::string_view> words;
+    for (auto _ : state) {
+        strings::split(text, delim, strings::skip_empty{}).into(words);
+        benchmark::DoNotOptimize(words.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void bm_split_whitespace(benchmark::State& state) {
+    const auto text = make_aligned_text(state.range(0));
+    const strings::by_whitespace delim;
+    std::vector<std::string_view> words;
+    for (auto _ : state) {
+        strings::split(text, delim, strings::skip_empty{}).into(words);
+        benchmark::DoNotOptimize(words.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+using vector_t = std::vector<std::string_view>;
+using small_vector_t = esl::small_vector<std::string_view, 16>;
+
+BENCHMARK_TEMPLATE(bm_split_by_char, vector_t)->RangeMultiplier(2)->Range(2, 64);
+BENCHMARK_TEMPLATE(bm_split_by_char, small_vector_t)->RangeMultiplier(2)->Range(2, 64);
+BENCHMARK_TEMPLATE(bm_split_by_length, vector_t)->RangeMultiplier(2)->Range(2, 64);
+BENCHMARK_TEMPLATE(bm_split_by_length, small_vector_t)->RangeMultiplier(2)->Range(2, 64);
+BENCHMARK(bm_split_then_trim)->RangeMultiplier(8)->Range(8, 1 << 15);
+BENCHMARK(bm_split_trim_fused)->RangeMultiplier(8)->Range(8, 1 << 15);
+BENCHMARK(bm_split_whitespace_by_any_char)->RangeMultiplier(8)->Range(64, 1 << 20);
+BENCHMARK(bm_split_whitespace)->RangeMultiplier(8)->Range(64, 1 << 20);
+BENCHMARK(bm_split_lines)->Arg(1 << 26);
+BENCHMARK(bm_parallel_split_lines)->Args({1 << 26, 2})->Args({1 << 26, 4})->Args({1 << 26, 8});
+
+} // namespace
@@ -0,0 +1,437 @@
+// Copyright (c) 2026 Kingsley Chen <kingsamchen at gmail dot com>
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "esl/detail/parallel.h"
+#include "esl/detail/simd.h"
+#include "esl/detail/strings_csv.h"
+#include "esl/strings.h"
+
+namespace esl {
+
+enum class csv_type {
+    int64,
+    float64,
+    // Views into the text, except values with escaped quotes, which are unescaped into
+    // storage owned by the table.
+    string,
+};
+
+enum class csv_error {
+    // Not a number of the column type, e.g. empty or with trailing characters.
+    invalid_value,
+    // A number not representable by the column type.
+    value_out_of_range,
+    too_few_fields,
+    too_many_fields,
+};
+
+// An error of a record, which is then left out of the table.
+struct csv_row_error {
+    // Index of the record in the text, the header included.
+    std::size_t record{0};
+    // Index of the first field in error; for `too_few_fields`, the number of fields.
+    std::size_t column{0};
+    csv_error error{csv_error::invalid_value};
+};
+
+struct csv_load_options {
+    strings::csv_dialect dialect;
+    // If true, the first record names the columns rather than holding values.
+    bool has_header{false};
+    // Maximum number of threads, the calling thread included; 0 for the hardware concurrency.
+    std::size_t threads{1};
+    // Minimum number of bytes for a thread to load; a shorter text takes fewer threads.
+    std::size_t min_chunk_size{std::size_t{1} << 20};
+};
+
+class csv_table;
+
+// Loads CSV `text` into columns of types given by `schema`, parsing numbers directly from the
+// text, and returns the table, whose string columns are views into `text`.
+// A record in error is left out and reported by `errors()`, and loading goes on.
+// With multiple threads, the text is split into chunks at record boundaries, which are found
+// by taking the parity of quotes before each chunk, and chunks are loaded concurrently.
+csv_table load_csv(std::string_view text,
+                   const std::vector<csv_type>& schema,
+                   const csv_load_options& options = {});
+
+namespace detail {
+
+using csv_column = std::variant<std::vector<std::int64_t>,
+                                std::vector<double>,
+                                std::vector<std::string_view>>;
+
+inline csv_column make_csv_column(csv_type type) {
+    switch (type) {
+    case csv_type::int64:
+        return std::vector<std::int64_t>();
+    case csv_type::float64:
+        return std::vector<double>();
+    case csv_type::string:
+        return std::vector<std::string_view>();
+    }
+    throw std::invalid_argument("unknown csv column type");
+}
+
+inline std::size_t csv_column_size(const csv_column& column) noexcept {
+    return std::visit([](const auto& values) { return values.size(); }, column);
+}
+
+inline bool parse_csv_number(std::string_view text, std::int64_t& value, csv_error& error) {
+    const auto last = text.data() + text.size();
+    const auto [ptr, ec] = std::from_chars(text.data(), last, value);
+    if (ec == std::errc::result_out_of_range) {
+        error = csv_error::value_out_of_range;
+        return false;
+    }
+    if (ec != std::errc{} || ptr != last) {
+        error = csv_error::invalid_value;
+        return false;
+    }
+    return true;
+}
+
+inline bool parse_csv_number(std::string_view text, double& value, csv_error& error) {
+#if defined(__cpp_lib_to_chars)
+    const auto last = text.data() + text.size();
+    const auto [ptr, ec] = std::from_chars(text.data(), last, value);
+    if (ec == std::errc::result_out_of_range) {
+        error = csv_error::value_out_of_range;
+        return false;
+    }
+    if (ec != std::errc{} || ptr != last) {
+        error = csv_error::invalid_value;
+        return false;
+    }
+    return true;
+#else
+    // Falls back to `strtod()`, which requires a null-terminated string and respects the
+    // locale, when `from_chars()` for floating-point is unavailable.
+    constexpr std::size_t max_number_size = 64;
+    char buf[max_number_size + 1];
+    if (text.empty() || text.size() > max_number_size ||
+        std::isspace(static_cast<unsigned char>(text.front())) != 0 || text.front() == '+') {
+        error = csv_error::invalid_value;
+        return false;
+    }
+    std::memcpy(buf, text.data(), text.size());
+    buf[text.size()] = '\0';
+    char* end{nullptr};
+    errno = 0;
+    value = std::strtod(buf, &end);
+    if (end != buf + text.size()) {
+        error = csv_error::invalid_value;
+        return false;
+    }
+    if (errno == ERANGE) {
+        error = csv_error::value_out_of_range;
+        return false;
+    }
+    return true;
+#endif
+}
+
+// Loads records of a chunk of text into columns.
+class csv_chunk_loader {
+public:
+    explicit csv_chunk_loader(const std::vector<csv_type>& schema) {
+        columns_.reserve(schema.size());
+        for (const auto type : schema) {
+            columns_.push_back(make_csv_column(type));
+        }
+    }
+
+    // Returns true to go on with the next field.
+    bool on_field(const strings::detail::csv_field& field, bool record_end) {
+        if (!row_failed_) {
+            if (column_ < columns_.size()) {
+                csv_error error{};
+                if (!append(columns_[column_], field, error)) {
+                    fail(column_, error);
+                }
+            } else {
+                fail(column_, csv_error::too_many_fields);
+            }
+        }
+        ++column_;
+
+        if (record_end) {
+            if (!row_failed_ && column_ < columns_.size()) {
+                fail(column_, csv_error::too_few_fields);
+            }
+            if (row_failed_) {
+                rollback();
+            } else {
+                ++rows_;
+            }
+            ++records_;
+            column_ = 0;
+            row_failed_ = false;
+            row_unescaped_ = unescaped_.size();
+        }
+        return true;
+    }
+
+    void reserve(std::size_t rows) {
+        for (auto& column : columns_) {
+            std::visit([rows](auto& values) { values.reserve(rows); }, column);
+        }
+    }
+
+    [[nodiscard]] std::size_t records() const noexcept {
+        return records_;
+    }
+
+    std::vector<csv_column>& columns() noexcept {
+        return columns_;
+    }
+
+    std::deque<std::string>& unescaped() noexcept {
+        return unescaped_;
+    }
+
+    // Records are numbered from the start of the chunk.
+    std::vector<csv_row_error>& errors() noexcept {
+        return errors_;
+    }
+
+private:
+    // Dispatches on the index rather than by `std::visit()`, which is costly per field.
+    bool append(csv_column& column, const strings::detail::csv_field& field, csv_error& error) {
+        switch (static_cast<csv_type>(column.index())) {
+        case csv_type::int64:
+            return parse_and_append(*std::get_if<std::vector<std::int64_t>>(&column), field, error);
+        case csv_type::float64:
+            return parse_and_append(*std::get_if<std::vector<double>>(&column), field, error);
+        case csv_type::string:
+            std::get_if<std::vector<std::string_view>>(&column)->push_back(
+                    field.escaped ? unescaped_.emplace_back(field.value()) : field.raw);
+            return true;
+        }
+        return false;
+    }
+
+    template<typename T>
+    static bool parse_and_append(std::vector<T>& values,
+                                 const strings::detail::csv_field& field,
+                                 csv_error& error) {
+        T value{};
+        if (!parse_csv_number(field.raw, value, error)) {
+            return false;
+        }
+        values.push_back(value);
+        return true;
+    }
+
+    void fail(std::size_t column, csv_error error) {
+        row_failed_ = true;
+        errors_.push_back(csv_row_error{records_, column, error});
+    }
+
+    // Drops values of the failed record.
+    void rollback() {
+        for (auto& column : columns_) {
+            std::visit([this](auto& values) { values.resize(std::min(values.size(), rows_)); },
+                       column);
+        }
+        unescaped_.resize(row_unescaped_);
+    }
+
+    std::vector<csv_column> columns_;
+    std::deque<std::string> unescaped_;
+    std::vector<csv_row_error> errors_;
+    std::size_t rows_{0};
+    std::size_t records_{0};
+    // Index of the next field in the current record.
+    std::size_t column_{0};
+    bool row_failed_{false};
+    // Size of `unescaped_` before the current record.
+    std::size_t row_unescaped_{0};
+};
+
+} // namespace detail
+
+// Typed columns loaded from CSV text; see `load_csv()`.
+class csv_table {
+public:
+    csv_table() = default;
+
+    [[nodiscard]] std::size_t rows() const noexcept {
+        return columns_.empty() ? 0 : detail::csv_column_size(columns_.front());
+    }
+
+    [[nodiscard]] std::size_t columns() const noexcept {
+        return columns_.size();
+    }
+
+    [[nodiscard]] csv_type column_type(std::size_t idx) const {
+        return static_cast<csv_type>(columns_.at(idx).index());
+    }
+
+    // `T` is `std::int64_t`, `double` or `std::string_view` for a column of type `int64`,
+    // `float64` or `string` respectively.
+    // Throws `std::invalid_argument` if `T` mismatches the column type.
+    template<typename T>
+    [[nodiscard]] const std::vector<T>& column(std::size_t idx) const {
+        const auto* values = std::get_if<std::vector<T>>(&columns_.at(idx));
+        if (values == nullptr) {
+            throw std::invalid_argument("csv column type mismatch");
+        }
+        return *values;
+    }
+
+    // Names of columns, which are empty if the text has no header.
+    [[nodiscard]] const std::vector<std::string>& header() const noexcept {
+        return header_;
+    }
+
+    // Errors in ascending order of records.
+    [[nodiscard]] const std::vector<csv_row_error>& errors() const noexcept {
+        return errors_;
+    }
+
+private:
+    friend csv_table load_csv(std::string_view text,
+                              const std::vector<csv_type>& schema,
+                              const csv_load_options& options);
+
+    std::vector<std::string> header_;
+    std::vector<detail::csv_column> columns_;
+    // Moving a deque keeps its elements in place, and thus views into them stay valid.
+    // The vector is reserved up front, since growing it may copy deques instead of moving them.
+    std::vector<std::deque<std::string>> unescaped_;
+    std::vector<csv_row_error> errors_;
+};
+
+inline csv_table load_csv(std::string_view text,
+                          const std::vector<csv_type>& schema,
+                          const csv_load_options& options) {
+    const auto separator = options.dialect.separator;
+    const auto quote = options.dialect.quote;
+
+    csv_table table;
+    std::size_t data_start{0};
+    std::size_t first_record{0};
+    if (options.has_header) {
+        data_start = strings::detail::find_next_csv_record(text, 0, false, separator, quote);
+        first_record = text.empty() ? 0 : 1;
+        strings::detail::for_each_csv_field(
+                text.substr(0, data_start), 0, separator, quote,
+                [&table](const strings::detail::csv_field& field, bool) {
+                    table.header_.push_back(field.value());
+                    return true;
+                });
+    }
+
+    const auto threads =
+            options.threads == 0 ? esl::detail::hardware_concurrency() : options.threads;
+    const auto data_size = text.size() - data_start;
+    const auto chunk_count = std::max<std::size_t>(
+            1, std::min(threads, data_size / std::max<std::size_t>(options.min_chunk_size, 1)));
+    auto chunk_first = [&](std::size_t idx) {
+        return data_start + data_size / chunk_count * idx;
+    };
+
+    // A chunk begins within quotes if and only if an odd number of quotes precede it.
+    std::vector<std::size_t> quotes(chunk_count);
+    esl::detail::parallel_for(chunk_count, [&](std::size_t idx) {
+        if (idx + 1 < chunk_count) {
+            const auto first = chunk_first(idx);
+            quotes[idx] = esl::detail::simd::count_matches(
+                    esl::detail::simd::char_matcher(quote),
+                    text.substr(first, chunk_first(idx + 1) - first), 0);
+        }
+    });
+
+    std::vector<bool> in_quotes(chunk_count);
+    for (std::size_t idx = 1, total = 0; idx < chunk_count; ++idx) {
+        total += quotes[idx - 1];
+        in_quotes[idx] = total % 2 != 0;
+    }
+
+    // A chunk actually starts at the first record beginning after its nominal start.
+    auto record_start = [&](std::size_t idx) {
+        if (idx == 0) {
+            return data_start;
+        }
+        if (idx == chunk_count) {
+            return text.size();
+        }
+        return strings::detail::find_next_csv_record(text, chunk_first(idx), in_quotes[idx],
+                                                     separator, quote);
+    };
+
+    std::vector<detail::csv_chunk_loader> loaders(chunk_count, detail::csv_chunk_loader(schema));
+    esl::detail::parallel_for(chunk_count, [&](std::size_t idx) {
+        auto& loader = loaders[idx];
+        const auto first = record_start(idx);
+        const auto last = record_start(idx + 1);
+        // Newlines bound the number of records, and counting them costs far less than growing
+        // columns repeatedly.
+        loader.reserve(esl::detail::simd::count_matches(esl::detail::simd::char_matcher('\n'),
+                                                        text.substr(first, last - first), 0) +
+                       1);
+        strings::detail::for_each_csv_field(
+                text.substr(0, last), first, separator, quote,
+                [&loader](const strings::detail::csv_field& field, bool record_end) {
+                    return loader.on_field(field, record_end);
+                });
+    });
+
+    // Merges chunks in order.
+    table.columns_ = std::move(loaders.front().columns());
+    for (std::size_t col = 0; col < table.columns_.size(); ++col) {
+        std::visit(
+                [&](auto& merged) {
+                    using values_t = std::decay_t<decltype(merged)>;
+                    std::size_t total = merged.size();
+                    for (std::size_t idx = 1; idx < chunk_count; ++idx) {
+                        total += std::get<values_t>(loaders[idx].columns()[col]).size();
+                    }
+                    merged.reserve(total);
+                    for (std::size_t idx = 1; idx < chunk_count; ++idx) {
+                        const auto& values = std::get<values_t>(loaders[idx].columns()[col]);
+                        merged.insert(merged.end(), values.begin(), values.end());
+                    }
+                },
+                table.columns_[col]);
+    }
+
+    auto record_base = first_record;
+    table.unescaped_.reserve(chunk_count);
+    for (auto& loader : loaders) {
+        for (auto error : loader.errors()) {
+            error.record += record_base;
+            table.errors_.push_back(error);
+        }
+        record_base += loader.records();
+        if (!loader.unescaped().empty()) {
+            table.unescaped_.push_back(std::move(loader.unescaped()));
+        }
+    }
+
+    return table;
+}
+
+} // namespace esl
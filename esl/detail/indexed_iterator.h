@@ -0,0 +1,115 @@
+// Copyright (c) 2026 Kingsley Chen <kingsamchen at gmail dot com>
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+
+namespace esl::detail {
+
+// A random access iterator over a container whose elements are made on the fly by
+// `container[idx]`, e.g. fields located by offsets.
+// Dereferencing returns elements by value, as there are no stored elements to refer to.
+template<typename Container>
+class indexed_iterator {
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = typename Container::value_type;
+    using reference = value_type;
+    using pointer = void;
+
+    indexed_iterator() noexcept = default;
+
+    indexed_iterator(const Container* container, std::size_t idx) noexcept
+        : container_(container),
+          idx_(idx) {}
+
+    reference operator*() const {
+        return (*container_)[idx_];
+    }
+
+    reference operator[](difference_type n) const {
+        return *(*this + n);
+    }
+
+    indexed_iterator& operator++() noexcept {
+        ++idx_;
+        return *this;
+    }
+
+    indexed_iterator operator++(int) noexcept {
+        auto old = *this;
+        ++idx_;
+        return old;
+    }
+
+    indexed_iterator& operator--() noexcept {
+        --idx_;
+        return *this;
+    }
+
+    indexed_iterator operator--(int) noexcept {
+        auto old = *this;
+        --idx_;
+        return old;
+    }
+
+    indexed_iterator& operator+=(difference_type n) noexcept {
+        idx_ = static_cast<std::size_t>(static_cast<difference_type>(idx_) + n);
+        return *this;
+    }
+
+    indexed_iterator& operator-=(difference_type n) noexcept {
+        return *this += -n;
+    }
+
+    friend indexed_iterator operator+(indexed_iterator it, difference_type n) noexcept {
+        return it += n;
+    }
+
+    friend indexed_iterator operator+(difference_type n, indexed_iterator it) noexcept {
+        return it += n;
+    }
+
+    friend indexed_iterator operator-(indexed_iterator it, difference_type n) noexcept {
+        return it -= n;
+    }
+
+    friend difference_type operator-(const indexed_iterator& lhs,
+                                     const indexed_iterator& rhs) noexcept {
+        return static_cast<difference_type>(lhs.idx_) - static_cast<difference_type>(rhs.idx_);
+    }
+
+    friend bool operator==(const indexed_iterator& lhs, const indexed_iterator& rhs) noexcept {
+        return lhs.idx_ == rhs.idx_;
+    }
+
+    friend bool operator!=(const indexed_iterator& lhs, const indexed_iterator& rhs) noexcept {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const indexed_iterator& lhs, const indexed_iterator& rhs) noexcept {
+        return lhs.idx_ < rhs.idx_;
+    }
+
+    friend bool operator>(const indexed_iterator& lhs, const indexed_iterator& rhs) noexcept {
+        return rhs < lhs;
+    }
+
+    friend bool operator<=(const indexed_iterator& lhs, const indexed_iterator& rhs) noexcept {
+        return !(rhs < lhs);
+    }
+
+    friend bool operator>=(const indexed_iterator& lhs, const indexed_iterator& rhs) noexcept {
+        return !(lhs < rhs);
+    }
+
+private:
+    const Container* container_{nullptr};
+    std::size_t idx_{0};
+};
+
+} // namespace esl::detail
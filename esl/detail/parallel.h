@@ -0,0 +1,64 @@
+// Copyright (c) 2026 Kingsley Chen <kingsamchen at gmail dot com>
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace esl::detail {
+
+// Returns the number of concurrent threads supported, at least 1.
+inline std::size_t hardware_concurrency() noexcept {
+    const auto count = std::thread::hardware_concurrency();
+    return count == 0 ? 1 : count;
+}
+
+// Calls `fn(idx)` for each `idx` in [0, count) on its own thread, and waits for all calls.
+// Index 0 runs on the calling thread; so do the indices whose threads fail to start.
+// Rethrows the exception of the lowest index, if any call throws.
+template<typename Fn>
+void parallel_for(std::size_t count, const Fn& fn) {
+    std::vector<std::exception_ptr> errors(count);
+    auto run = [&fn, &errors](std::size_t idx) noexcept {
+        try {
+            fn(idx);
+        } catch (...) {
+            errors[idx] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    std::size_t started{1};
+    try {
+        workers.reserve(count > 0 ? count - 1 : 0);
+        for (; started < count; ++started) {
+            workers.emplace_back(run, started);
+        }
+    } catch (...) {
+        // Runs the rest inline.
+    }
+
+    if (count > 0) {
+        run(0);
+    }
+
+    for (auto idx = started; idx < count; ++idx) {
+        run(idx);
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+} // namespace esl::detail
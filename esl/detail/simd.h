@@ -0,0 +1,610 @@
+// Copyright (c) 2026 Kingsley Chen <kingsamchen at gmail dot com>
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <utility>
+
+// Instruction sets are selected at compile time by target flags, e.g. `-mavx2` or `/arch:AVX2`.
+// Kernels fall back to portable scalar code when none is available.
+
+#if defined(__AVX2__)
+#define ESL_SIMD_AVX2 1
+#endif
+
+#if defined(__SSSE3__) || defined(__AVX__)
+#define ESL_SIMD_SSSE3 1
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ESL_SIMD_SSE2 1
+#endif
+
+#if defined(ESL_SIMD_AVX2)
+#include <immintrin.h>
+#elif defined(ESL_SIMD_SSSE3)
+#include <tmmintrin.h>
+#elif defined(ESL_SIMD_SSE2)
+#include <emmintrin.h>
+#endif
+
+#if defined(__PCLMUL__) && defined(__x86_64__)
+#define ESL_SIMD_PCLMUL 1
+#include <wmmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace esl::detail::simd {
+
+// Kernels summarize every block of this many bytes into a 64-bit mask, where bit i is set
+// if and only if the i-th byte of the block matches.
+inline constexpr std::size_t block_size = 64;
+
+// The behavior is undefined if `mask` is 0.
+inline unsigned count_trailing_zeros(std::uint64_t mask) noexcept {
+#if defined(_MSC_VER) && defined(_M_X64)
+    unsigned long idx{0}; // NOLINT(google-runtime-int)
+    _BitScanForward64(&idx, mask);
+    return static_cast<unsigned>(idx);
+#elif defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctzll(mask));
+#else
+    unsigned cnt = 0;
+    for (; (mask & 1) == 0; mask >>= 1) {
+        ++cnt;
+    }
+    return cnt;
+#endif
+}
+
+// The behavior is undefined if `mask` is 0.
+inline unsigned count_leading_zeros(std::uint64_t mask) noexcept {
+#if defined(_MSC_VER) && defined(_M_X64)
+    unsigned long idx{0}; // NOLINT(google-runtime-int)
+    _BitScanReverse64(&idx, mask);
+    return 63 - static_cast<unsigned>(idx);
+#elif defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_clzll(mask));
+#else
+    unsigned cnt = 0;
+    for (; (mask & (std::uint64_t{1} << 63)) == 0; mask <<= 1) {
+        ++cnt;
+    }
+    return cnt;
+#endif
+}
+
+inline unsigned popcount(std::uint64_t mask) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_popcountll(mask));
+#else
+    mask = mask - ((mask >> 1) & 0x5555555555555555ULL);
+    mask = (mask & 0x3333333333333333ULL) + ((mask >> 2) & 0x3333333333333333ULL);
+    mask = (mask + (mask >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    return static_cast<unsigned>((mask * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+inline std::uint64_t clear_lowest_bit(std::uint64_t mask) noexcept {
+    return mask & (mask - 1);
+}
+
+// Returns a mask where bit i is the XOR of bits [0, i] of `mask`; e.g. for a mask of quotes,
+// bits from an opening quote up to, but excluding, its closing quote are set.
+// A carry-less multiplication by all ones computes it at once where available.
+inline std::uint64_t prefix_xor(std::uint64_t mask) noexcept {
+#if defined(ESL_SIMD_PCLMUL)
+    const auto product = _mm_clmulepi64_si128(
+            _mm_set_epi64x(0, static_cast<std::int64_t>(mask)), _mm_set1_epi8(-1), 0);
+    return static_cast<std::uint64_t>(_mm_cvtsi128_si64(product));
+#else
+    mask ^= mask << 1;
+    mask ^= mask << 2;
+    mask ^= mask << 4;
+    mask ^= mask << 8;
+    mask ^= mask << 16;
+    mask ^= mask << 32;
+    return mask;
+#endif
+}
+
+#if defined(ESL_SIMD_AVX2)
+
+inline __m256i load_unaligned_32(const char* p) noexcept {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
+
+inline void store_unaligned_32(char* p, __m256i v) noexcept {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+}
+
+inline std::uint64_t to_mask_32(__m256i v) noexcept {
+    return static_cast<std::uint32_t>(_mm256_movemask_epi8(v));
+}
+
+#endif
+
+#if defined(ESL_SIMD_SSE2)
+
+inline __m128i load_unaligned_16(const char* p) noexcept {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+inline void store_unaligned_16(char* p, __m128i v) noexcept {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+}
+
+inline std::uint64_t to_mask_16(__m128i v) noexcept {
+    return static_cast<std::uint16_t>(_mm_movemask_epi8(v));
+}
+
+#endif
+
+#if defined(ESL_SIMD_AVX2)
+
+// Flips case of bytes in range ['A', 'Z'] if `first` is 'A', or in range ['a', 'z'] if `first`
+// is 'a', while retaining other bytes.
+inline __m256i ascii_flip_case_32(__m256i v, char first) noexcept {
+    const auto offset = _mm256_sub_epi8(v, _mm256_set1_epi8(first));
+    const auto in_range = _mm256_cmpeq_epi8(_mm256_min_epu8(offset, _mm256_set1_epi8(25)), offset);
+    return _mm256_xor_si256(v, _mm256_and_si256(in_range, _mm256_set1_epi8(0x20)));
+}
+
+inline __m256i ascii_to_lower_32(__m256i v) noexcept {
+    return ascii_flip_case_32(v, 'A');
+}
+
+inline __m256i ascii_to_upper_32(__m256i v) noexcept {
+    return ascii_flip_case_32(v, 'a');
+}
+
+#endif
+
+#if defined(ESL_SIMD_SSE2)
+
+// See `ascii_flip_case_32()`.
+inline __m128i ascii_flip_case_16(__m128i v, char first) noexcept {
+    const auto offset = _mm_sub_epi8(v, _mm_set1_epi8(first));
+    const auto in_range = _mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8(25)), offset);
+    return _mm_xor_si128(v, _mm_and_si128(in_range, _mm_set1_epi8(0x20)));
+}
+
+inline __m128i ascii_to_lower_16(__m128i v) noexcept {
+    return ascii_flip_case_16(v, 'A');
+}
+
+inline __m128i ascii_to_upper_16(__m128i v) noexcept {
+    return ascii_flip_case_16(v, 'a');
+}
+
+#endif
+
+// A `Matcher` classifies bytes and must provide:
+//   bool match(char ch) const noexcept;
+//   std::uint64_t block_mask(const char* p) const noexcept;
+// where `block_mask()` classifies `block_size` bytes starting at `p`.
+
+// Classifies up to `block_size` bytes one by one.
+template<typename Matcher>
+std::uint64_t scalar_block_mask(const Matcher& matcher, const char* p, std::size_t len) noexcept {
+    std::uint64_t mask{0};
+    for (std::size_t i = 0; i < len; ++i) {
+        if (matcher.match(p[i])) {
+            mask |= std::uint64_t{1} << i;
+        }
+    }
+    return mask;
+}
+
+// Classifies the last partial block of `len` bytes, where `len` < `block_size`.
+// Copying into a local block avoids reading past the end of the text.
+template<typename Matcher>
+std::uint64_t tail_block_mask(const Matcher& matcher, const char* p, std::size_t len) noexcept {
+    char block[block_size]{};
+    std::memcpy(block, p, len);
+    return matcher.block_mask(block) & ((std::uint64_t{1} << len) - 1);
+}
+
+// Calls `fn(pos)` for every matched position at or after `pos` in ascending order.
+// Stops as soon as `fn` returns false, and returns false in this case.
+template<typename Matcher, typename Fn>
+bool for_each_match(const Matcher& matcher, std::string_view text, std::size_t pos, Fn&& fn) {
+    auto&& on_match = std::forward<Fn>(fn);
+    auto visit = [&on_match](std::size_t block_pos, std::uint64_t mask) {
+        for (; mask != 0; mask = clear_lowest_bit(mask)) {
+            if (!on_match(block_pos + count_trailing_zeros(mask))) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    if (pos >= text.size()) {
+        return true;
+    }
+
+    const char* data = text.data();
+    for (; text.size() - pos >= block_size; pos += block_size) {
+        if (!visit(pos, matcher.block_mask(data + pos))) {
+            return false;
+        }
+    }
+
+    return pos == text.size() ||
+           visit(pos, tail_block_mask(matcher, data + pos, text.size() - pos));
+}
+
+// Returns the first matched position at or after `pos`, or `npos` if there is no match.
+template<typename Matcher>
+std::size_t find_first(const Matcher& matcher, std::string_view text, std::size_t pos) noexcept {
+    if (pos >= text.size()) {
+        return std::string_view::npos;
+    }
+
+    const char* data = text.data();
+    for (; text.size() - pos >= block_size; pos += block_size) {
+        if (const auto mask = matcher.block_mask(data + pos); mask != 0) {
+            return pos + count_trailing_zeros(mask);
+        }
+    }
+
+    if (pos == text.size()) {
+        return std::string_view::npos;
+    }
+
+    const auto mask = tail_block_mask(matcher, data + pos, text.size() - pos);
+    return mask != 0 ? pos + count_trailing_zeros(mask) : std::string_view::npos;
+}
+
+// Returns the last matched position before `end`, or `npos` if there is no match.
+// Blocks are scanned backwards from `end`, so that a match near the end is found without
+// scanning the text before it.
+template<typename Matcher>
+std::size_t find_last(const Matcher& matcher, std::string_view text, std::size_t end) noexcept {
+    end = end < text.size() ? end : text.size();
+    const char* data = text.data();
+    for (; end >= block_size; end -= block_size) {
+        if (const auto mask = matcher.block_mask(data + end - block_size); mask != 0) {
+            return end - 1 - count_leading_zeros(mask);
+        }
+    }
+
+    if (end == 0) {
+        return std::string_view::npos;
+    }
+
+    const auto mask = tail_block_mask(matcher, data, end);
+    return mask != 0 ? block_size - 1 - count_leading_zeros(mask) : std::string_view::npos;
+}
+
+// Runs of consecutive matches are located by clearing bits preceded by a matched bit, which
+// carries across blocks; a run covering `pos` is taken as starting at `pos`.
+
+// Calls `fn(run_pos)` for the first position of every run at or after `pos` in ascending
+// order. Stops as soon as `fn` returns false, and returns false in this case.
+template<typename Matcher, typename Fn>
+bool for_each_run(const Matcher& matcher, std::string_view text, std::size_t pos, Fn&& fn) {
+    auto&& on_run = std::forward<Fn>(fn);
+    std::uint64_t carry{0};
+    auto visit = [&on_run, &carry](std::size_t block_pos, std::uint64_t mask) {
+        auto starts = mask & ~((mask << 1) | carry);
+        carry = mask >> (block_size - 1);
+        for (; starts != 0; starts = clear_lowest_bit(starts)) {
+            if (!on_run(block_pos + count_trailing_zeros(starts))) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    if (pos >= text.size()) {
+        return true;
+    }
+
+    const char* data = text.data();
+    for (; text.size() - pos >= block_size; pos += block_size) {
+        if (!visit(pos, matcher.block_mask(data + pos))) {
+            return false;
+        }
+    }
+
+    return pos == text.size() ||
+           visit(pos, tail_block_mask(matcher, data + pos, text.size() - pos));
+}
+
+// Returns the number of consecutive matches starting at `pos`.
+// Short runs, which are the most, are measured byte by byte before switching to blocks.
+template<typename Matcher>
+std::size_t run_length(const Matcher& matcher, std::string_view text, std::size_t pos) noexcept {
+    constexpr std::size_t short_run = 16;
+    const auto start = pos;
+    const char* data = text.data();
+    for (const auto end = std::min(text.size(), pos + short_run); pos < end; ++pos) {
+        if (!matcher.match(data[pos])) {
+            return pos - start;
+        }
+    }
+
+    for (; pos < text.size(); pos += block_size) {
+        const auto remaining = text.size() - pos;
+        const auto mask = remaining >= block_size
+                                  ? matcher.block_mask(data + pos)
+                                  : tail_block_mask(matcher, data + pos, remaining);
+        if (~mask != 0) {
+            return std::min(pos + count_trailing_zeros(~mask), text.size()) - start;
+        }
+    }
+    return text.size() - start;
+}
+
+// Returns the number of runs at or after `pos`, by a popcount per block.
+template<typename Matcher>
+std::size_t count_runs(const Matcher& matcher, std::string_view text, std::size_t pos) noexcept {
+    if (pos >= text.size()) {
+        return 0;
+    }
+
+    std::size_t count{0};
+    std::uint64_t carry{0};
+    auto count_starts = [&count, &carry](std::uint64_t mask) {
+        count += popcount(mask & ~((mask << 1) | carry));
+        carry = mask >> (block_size - 1);
+    };
+
+    const char* data = text.data();
+    for (; text.size() - pos >= block_size; pos += block_size) {
+        count_starts(matcher.block_mask(data + pos));
+    }
+
+    if (pos != text.size()) {
+        count_starts(tail_block_mask(matcher, data + pos, text.size() - pos));
+    }
+
+    return count;
+}
+
+// Returns the number of matched positions at or after `pos`.
+// Each block costs a popcount of its mask, regardless of how many bytes match.
+template<typename Matcher>
+std::size_t count_matches(const Matcher& matcher, std::string_view text, std::size_t pos) noexcept {
+    if (pos >= text.size()) {
+        return 0;
+    }
+
+    std::size_t count{0};
+    const char* data = text.data();
+    for (; text.size() - pos >= block_size; pos += block_size) {
+        count += popcount(matcher.block_mask(data + pos));
+    }
+
+    if (pos != text.size()) {
+        count += popcount(tail_block_mask(matcher, data + pos, text.size() - pos));
+    }
+
+    return count;
+}
+
+class char_matcher {
+public:
+    explicit char_matcher(char ch) noexcept
+        : ch_(ch) {}
+
+    [[nodiscard]] bool match(char ch) const noexcept {
+        return ch == ch_;
+    }
+
+    [[nodiscard]] std::uint64_t block_mask(const char* p) const noexcept {
+#if defined(ESL_SIMD_AVX2)
+        const auto needle = _mm256_set1_epi8(ch_);
+        return to_mask_32(_mm256_cmpeq_epi8(load_unaligned_32(p), needle)) |
+               to_mask_32(_mm256_cmpeq_epi8(load_unaligned_32(p + 32), needle)) << 32;
+#elif defined(ESL_SIMD_SSE2)
+        const auto needle = _mm_set1_epi8(ch_);
+        return to_mask_16(_mm_cmpeq_epi8(load_unaligned_16(p), needle)) |
+               to_mask_16(_mm_cmpeq_epi8(load_unaligned_16(p + 16), needle)) << 16 |
+               to_mask_16(_mm_cmpeq_epi8(load_unaligned_16(p + 32), needle)) << 32 |
+               to_mask_16(_mm_cmpeq_epi8(load_unaligned_16(p + 48), needle)) << 48;
+#else
+        return scalar_block_mask(*this, p, block_size);
+#endif
+    }
+
+    [[nodiscard]] char value() const noexcept {
+        return ch_;
+    }
+
+private:
+    char ch_;
+};
+
+// Matches any byte of a given set.
+// The set is precompiled into a 256-bit bitmap for scalar classification, and into nibble
+// lookup tables (a.k.a. shufti) for SSSE3/AVX2, where a byte `b` matches if and only if
+//   lo_table[b & 0xf] & hi_table[b >> 4] != 0
+// Bytes are bucketed by whichever of their high or low nibbles yields fewer buckets; each
+// bucket owns one bit of a table entry, and a second pair of tables is used if there are
+// more than 8 buckets, so that any set is matched exactly.
+// On plain SSE2, sets of up to 16 distinct bytes are compared one byte value at a time.
+class char_set_matcher {
+    struct nibble_tables {
+        std::uint8_t lo[16]{};
+        std::uint8_t hi[16]{};
+    };
+
+public:
+    static constexpr std::size_t max_compared_bytes = 16;
+
+    explicit char_set_matcher(std::string_view chars) noexcept {
+        for (const char ch : chars) {
+            if (match(ch)) {
+                continue;
+            }
+            const auto uc = static_cast<unsigned char>(ch);
+            bitmap_[uc >> 6] |= std::uint64_t{1} << (uc & 63);
+            if (byte_count_ < max_compared_bytes) {
+                bytes_[byte_count_] = ch;
+            }
+            ++byte_count_;
+        }
+        build_nibble_tables();
+    }
+
+    [[nodiscard]] bool match(char ch) const noexcept {
+        const auto uc = static_cast<unsigned char>(ch);
+        return ((bitmap_[uc >> 6] >> (uc & 63)) & 1) != 0;
+    }
+
+    [[nodiscard]] std::uint64_t block_mask(const char* p) const noexcept {
+#if defined(ESL_SIMD_AVX2)
+        return mask_32(p) | mask_32(p + 32) << 32;
+#elif defined(ESL_SIMD_SSE2)
+        return mask_16(p) | mask_16(p + 16) << 16 | mask_16(p + 32) << 32 | mask_16(p + 48) << 48;
+#else
+        return scalar_block_mask(*this, p, block_size);
+#endif
+    }
+
+    // Returns the number of distinct bytes in the set.
+    [[nodiscard]] std::size_t size() const noexcept {
+        return byte_count_;
+    }
+
+private:
+    void build_nibble_tables() noexcept {
+        unsigned hi_nibbles{0};
+        unsigned lo_nibbles{0};
+        for (unsigned b = 0; b < 256; ++b) {
+            if (match(static_cast<char>(b))) {
+                hi_nibbles |= 1U << (b >> 4);
+                lo_nibbles |= 1U << (b & 0xf);
+            }
+        }
+
+        const bool by_hi_nibble = popcount(hi_nibbles) <= popcount(lo_nibbles);
+        const auto keys = by_hi_nibble ? hi_nibbles : lo_nibbles;
+        two_tables_ = popcount(keys) > 8;
+        for (unsigned b = 0; b < 256; ++b) {
+            if (!match(static_cast<char>(b))) {
+                continue;
+            }
+            const auto hi = b >> 4;
+            const auto lo = b & 0xf;
+            const auto key = by_hi_nibble ? hi : lo;
+            const auto bucket = popcount(keys & ((1U << key) - 1));
+            const auto bit = static_cast<std::uint8_t>(1U << (bucket % 8));
+            auto& tables = bucket < 8 ? tables_[0] : tables_[1];
+            tables.lo[lo] |= bit;
+            tables.hi[hi] |= bit;
+        }
+    }
+
+#if defined(ESL_SIMD_AVX2)
+    [[nodiscard]] std::uint64_t mask_32(const char* p) const noexcept {
+        const auto v = load_unaligned_32(p);
+        const auto lo = _mm256_and_si256(v, _mm256_set1_epi8(0x0f));
+        const auto hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0f));
+        auto r = lookup_32(tables_[0], lo, hi);
+        if (two_tables_) {
+            r = _mm256_or_si256(r, lookup_32(tables_[1], lo, hi));
+        }
+        return ~to_mask_32(_mm256_cmpeq_epi8(r, _mm256_setzero_si256())) & 0xffffffffULL;
+    }
+
+    static __m256i lookup_32(const nibble_tables& tables, __m256i lo, __m256i hi) noexcept {
+        const auto lo_table = _mm256_broadcastsi128_si256(load_table(tables.lo));
+        const auto hi_table = _mm256_broadcastsi128_si256(load_table(tables.hi));
+        return _mm256_and_si256(_mm256_shuffle_epi8(lo_table, lo),
+                                _mm256_shuffle_epi8(hi_table, hi));
+    }
+#endif
+
+#if defined(ESL_SIMD_SSSE3)
+    static __m128i load_table(const std::uint8_t (&table)[16]) noexcept {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(table));
+    }
+
+    static __m128i lookup_16(const nibble_tables& tables, __m128i lo, __m128i hi) noexcept {
+        return _mm_and_si128(_mm_shuffle_epi8(load_table(tables.lo), lo),
+                             _mm_shuffle_epi8(load_table(tables.hi), hi));
+    }
+#endif
+
+#if defined(ESL_SIMD_SSE2)
+    [[nodiscard]] std::uint64_t mask_16(const char* p) const noexcept {
+        const auto v = load_unaligned_16(p);
+#if defined(ESL_SIMD_SSSE3)
+        const auto lo = _mm_and_si128(v, _mm_set1_epi8(0x0f));
+        const auto hi = _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0f));
+        auto r = lookup_16(tables_[0], lo, hi);
+        if (two_tables_) {
+            r = _mm_or_si128(r, lookup_16(tables_[1], lo, hi));
+        }
+        return ~to_mask_16(_mm_cmpeq_epi8(r, _mm_setzero_si128())) & 0xffffULL;
+#else
+        if (byte_count_ > max_compared_bytes) {
+            return scalar_block_mask(*this, p, 16);
+        }
+        auto r = _mm_setzero_si128();
+        for (std::size_t i = 0; i < byte_count_; ++i) {
+            r = _mm_or_si128(r, _mm_cmpeq_epi8(v, _mm_set1_epi8(bytes_[i])));
+        }
+        return to_mask_16(r);
+#endif
+    }
+#endif
+
+    std::uint64_t bitmap_[4]{};
+    char bytes_[max_compared_bytes]{};
+    std::size_t byte_count_{0};
+    nibble_tables tables_[2]{};
+    bool two_tables_{false};
+};
+
+// Matches a byte ignoring ASCII case.
+class char_matcher_ignore_ascii_case {
+public:
+    explicit char_matcher_ignore_ascii_case(char ch) noexcept
+        : lower_('A' <= ch && ch <= 'Z' ? static_cast<char>(ch - 'A' + 'a') : ch) {}
+
+    [[nodiscard]] bool match(char ch) const noexcept {
+        return ch == lower_ || ('A' <= ch && ch <= 'Z' && ch - 'A' + 'a' == lower_);
+    }
+
+    [[nodiscard]] std::uint64_t block_mask(const char* p) const noexcept {
+#if defined(ESL_SIMD_AVX2)
+        const auto needle = _mm256_set1_epi8(lower_);
+        return to_mask_32(_mm256_cmpeq_epi8(ascii_to_lower_32(load_unaligned_32(p)), needle)) |
+               to_mask_32(_mm256_cmpeq_epi8(ascii_to_lower_32(load_unaligned_32(p + 32)), needle))
+                       << 32;
+#elif defined(ESL_SIMD_SSE2)
+        const auto needle = _mm_set1_epi8(lower_);
+        std::uint64_t mask{0};
+        for (std::size_t i = 0; i < block_size; i += 16) {
+            const auto v = ascii_to_lower_16(load_unaligned_16(p + i));
+            mask |= to_mask_16(_mm_cmpeq_epi8(v, needle)) << i;
+        }
+        return mask;
+#else
+        return scalar_block_mask(*this, p, block_size);
+#endif
+    }
+
+private:
+    char lower_;
+};
+
+} // namespace esl::detail::simd
@@ -0,0 +1,182 @@
+// Copyright (c) 2026 Kingsley Chen <kingsamchen at gmail dot com>
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "esl/detail/simd.h"
+#include "esl/detail/strings_lines.h"
+
+namespace esl::strings::detail {
+
+// Fields are separated by a separator and records are terminated by "\n" or "\r\n", except
+// within quotes. A quote toggles quoting wherever it appears, and an escaped quote, i.e. two
+// consecutive quotes, toggles twice.
+
+// Calls `fn(pos, record_end)` for each separator and newline outside quotes at or after `pos`,
+// where `record_end` is true for a newline; `in_quotes` tells whether `pos` is within quotes.
+// Bytes are classified a 64-byte block at a time; a prefix XOR over the quote mask of a block
+// marks bytes within quotes, carrying the state across blocks.
+// Stops as soon as `fn` returns false, and returns false in this case.
+template<typename Fn>
+bool for_each_csv_boundary(std::string_view text,
+                           std::size_t pos,
+                           bool in_quotes,
+                           char separator,
+                           char quote,
+                           Fn&& fn) {
+    namespace simd = esl::detail::simd;
+
+    auto&& on_boundary = std::forward<Fn>(fn);
+    const simd::char_matcher quotes(quote);
+    const simd::char_matcher separators(separator);
+    const simd::char_matcher newlines('\n');
+    std::uint64_t carry = in_quotes ? ~std::uint64_t{0} : 0;
+    auto visit = [&](std::size_t block_pos, const char* block, std::uint64_t valid) {
+        const auto quoted = simd::prefix_xor(quotes.block_mask(block) & valid) ^ carry;
+        carry = 0 - (quoted >> (simd::block_size - 1));
+        const auto newline_mask = newlines.block_mask(block);
+        auto mask = (separators.block_mask(block) | newline_mask) & valid & ~quoted;
+        for (; mask != 0; mask = simd::clear_lowest_bit(mask)) {
+            const auto idx = simd::count_trailing_zeros(mask);
+            if (!on_boundary(block_pos + idx, ((newline_mask >> idx) & 1) != 0)) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    if (pos >= text.size()) {
+        return true;
+    }
+
+    const char* data = text.data();
+    for (; text.size() - pos >= simd::block_size; pos += simd::block_size) {
+        if (!visit(pos, data + pos, ~std::uint64_t{0})) {
+            return false;
+        }
+    }
+
+    if (pos == text.size()) {
+        return true;
+    }
+
+    // Copying into a local block avoids reading past the end of the text.
+    const auto len = text.size() - pos;
+    char block[simd::block_size]{};
+    std::memcpy(block, data + pos, len);
+    return visit(pos, block, (std::uint64_t{1} << len) - 1);
+}
+
+// A field of CSV text.
+struct csv_field {
+    // The field with its enclosing quotes, if any, removed; escaped quotes within remain as is.
+    std::string_view raw;
+    // True if `raw` contains escaped quotes, and thus differs from the value of the field.
+    bool escaped{false};
+    char quote{'"'};
+
+    // Returns the value of the field, with escaped quotes unescaped.
+    [[nodiscard]] std::string value() const {
+        if (!escaped) {
+            return std::string(raw);
+        }
+
+        std::string unescaped;
+        unescaped.reserve(raw.size());
+        for (std::size_t i = 0; i < raw.size(); ++i) {
+            unescaped.push_back(raw[i]);
+            if (raw[i] == quote && i + 1 < raw.size() && raw[i + 1] == quote) {
+                ++i;
+            }
+        }
+        return unescaped;
+    }
+};
+
+// A field not enclosed in quotes as a whole, e.g. `"a"b`, is taken verbatim.
+inline csv_field make_csv_field(std::string_view text, char quote) noexcept {
+    if (text.size() >= 2 && text.front() == quote && text.back() == quote) {
+        const auto inner = text.substr(1, text.size() - 2);
+        return csv_field{inner, inner.find(quote) != std::string_view::npos, quote};
+    }
+    return csv_field{text, false, quote};
+}
+
+// Calls `fn(field, record_end)` for each field in `text` at or after `pos`, where `pos` must
+// start a record, and `record_end` is true for the last field of a record.
+// The last record may be unterminated; thus a text ending with a terminator has no empty
+// record after it, and an empty text has no records at all.
+template<typename Fn>
+bool for_each_csv_field(std::string_view text,
+                        std::size_t pos,
+                        char separator,
+                        char quote,
+                        Fn&& fn) {
+    auto&& on_field = std::forward<Fn>(fn);
+    auto field_start = pos;
+    const bool completed = for_each_csv_boundary(
+            text, pos, false, separator, quote, [&](std::size_t boundary, bool record_end) {
+                auto field = text.substr(field_start, boundary - field_start);
+                field_start = boundary + 1;
+                if (record_end) {
+                    field = strip_carriage_return(field);
+                }
+                return on_field(make_csv_field(field, quote), record_end);
+            });
+    if (!completed) {
+        return false;
+    }
+
+    // A separator at the end leaves an empty field behind.
+    if (pos < text.size() && (field_start < text.size() || text.back() != '\n')) {
+        return on_field(make_csv_field(text.substr(field_start), quote), true);
+    }
+    return true;
+}
+
+// Calls `fn(fields)` for each record in `text`, with `fields` in a vector reused across records.
+template<typename Fn>
+bool for_each_csv_record(std::string_view text, char separator, char quote, Fn&& fn) {
+    auto&& on_record = std::forward<Fn>(fn);
+    std::vector<csv_field> fields;
+    return for_each_csv_field(
+            text, 0, separator, quote, [&](const csv_field& field, bool record_end) {
+                fields.push_back(field);
+                if (!record_end) {
+                    return true;
+                }
+                const bool proceed =
+                        on_record(static_cast<const std::vector<csv_field>&>(fields));
+                fields.clear();
+                return proceed;
+            });
+}
+
+// Returns the start of the first record beginning after `pos`, or the size of `text` if there
+// is none; `in_quotes` tells whether `pos` is within quotes.
+inline std::size_t find_next_csv_record(std::string_view text,
+                                        std::size_t pos,
+                                        bool in_quotes,
+                                        char separator,
+                                        char quote) {
+    auto next = text.size();
+    for_each_csv_boundary(text, pos, in_quotes, separator, quote,
+                          [&next](std::size_t boundary, bool record_end) {
+                              if (record_end) {
+                                  next = boundary + 1;
+                              }
+                              return !record_end;
+                          });
+    return next;
+}
+
+} // namespace esl::strings::detail
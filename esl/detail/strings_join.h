@@ -71,9 +71,10 @@ join_impl(Iterator first, Iterator last, std::string_view sep, std::string& out)
         return;
     }
 
-    std::size_t total_len = first->size();
+    // Not to use `operator->`, which is absent in iterators making elements on the fly.
+    std::size_t total_len = (*first).size();
     for (auto it = std::next(first); it != last; ++it) {
-        total_len += sep.size() + it->size();
+        total_len += sep.size() + (*it).size();
     }
 
     out.reserve(total_len);
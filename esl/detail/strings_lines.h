@@ -0,0 +1,198 @@
+// Copyright (c) 2026 Kingsley Chen <kingsamchen at gmail dot com>
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "esl/detail/simd.h"
+
+namespace esl::strings::detail {
+
+// Lines are terminated by "\n" or "\r\n", and terminators are excluded from lines.
+// The last line may be unterminated; thus a text ending with a terminator has no empty line
+// after it, and an empty text has no lines at all.
+
+inline std::string_view strip_carriage_return(std::string_view line) noexcept {
+    return !line.empty() && line.back() == '\r' ? line.substr(0, line.size() - 1) : line;
+}
+
+// Calls `fn(line)` for each terminated line in `text`, scanning for '\n' a 64-byte block at
+// a time; an unterminated tail is left alone.
+// Returns where the tail begins, or `npos` if stopped by `fn` returning false.
+template<typename Fn>
+std::size_t for_each_terminated_line(std::string_view text, Fn&& fn) {
+    auto&& on_line = std::forward<Fn>(fn);
+    const esl::detail::simd::char_matcher newline('\n');
+    std::size_t line_start{0};
+    const bool completed =
+            esl::detail::simd::for_each_match(newline, text, 0, [&](std::size_t pos) {
+                const auto line = text.substr(line_start, pos - line_start);
+                line_start = pos + 1;
+                return on_line(strip_carriage_return(line));
+            });
+    return completed ? line_start : std::string_view::npos;
+}
+
+class line_iterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::string_view;
+    using reference = const value_type&;
+    using pointer = const value_type*;
+
+    // Construct an end iterator.
+    line_iterator() noexcept = default;
+
+    // Construct a begin iterator.
+    explicit line_iterator(std::string_view text)
+        : text_(text),
+          pos_(0) {
+        advance();
+    }
+
+    line_iterator& operator++() {
+        advance();
+        return *this;
+    }
+
+    line_iterator operator++(int) {
+        line_iterator old(*this);
+        ++(*this);
+        return old;
+    }
+
+    reference operator*() const noexcept {
+        return curr_;
+    }
+
+    pointer operator->() const noexcept {
+        return &curr_;
+    }
+
+    friend bool operator==(const line_iterator& lhs, const line_iterator& rhs) noexcept {
+        return lhs.pos_ == rhs.pos_;
+    }
+
+    friend bool operator!=(const line_iterator& lhs, const line_iterator& rhs) noexcept {
+        return !(lhs == rhs);
+    }
+
+private:
+    void advance() {
+        assert(pos_ != std::string_view::npos);
+        if (pos_ == std::string_view::npos) {
+            throw std::logic_error("cannot advance an end line_iterator");
+        }
+
+        if (pos_ == text_.size()) {
+            pos_ = std::string_view::npos;
+            return;
+        }
+
+        const auto newline = esl::detail::simd::find_first(
+                esl::detail::simd::char_matcher('\n'), text_, pos_);
+        if (newline == std::string_view::npos) {
+            curr_ = text_.substr(pos_);
+            pos_ = text_.size();
+        } else {
+            curr_ = strip_carriage_return(text_.substr(pos_, newline - pos_));
+            pos_ = newline + 1;
+        }
+    }
+
+    std::string_view text_;
+    // Start of the next line; `npos` if at the end.
+    std::size_t pos_{std::string_view::npos};
+    std::string_view curr_;
+};
+
+template<typename Container, typename = void>
+struct has_reserve : std::false_type {};
+
+template<typename Container>
+struct has_reserve<Container,
+                   std::void_t<decltype(std::declval<Container&>().reserve(std::size_t{}))>>
+    : std::true_type {};
+
+class line_view {
+public:
+    using const_iterator = line_iterator;
+    using iterator = const_iterator;
+
+    explicit line_view(std::string_view text) noexcept
+        : text_(text) {}
+
+    [[nodiscard]] iterator begin() const {
+        return iterator(text_);
+    }
+
+    [[nodiscard]] const_iterator cbegin() const {
+        return begin();
+    }
+
+    [[nodiscard]] iterator end() const noexcept {
+        return iterator();
+    }
+
+    [[nodiscard]] const_iterator cend() const noexcept {
+        return end();
+    }
+
+    [[nodiscard]] std::string_view text() const noexcept {
+        return text_;
+    }
+
+    // Returns the number of lines, by a popcount of newlines per 64-byte block.
+    [[nodiscard]] std::size_t count() const noexcept {
+        const auto newlines = esl::detail::simd::count_matches(
+                esl::detail::simd::char_matcher('\n'), text_, 0);
+        return newlines + (!text_.empty() && text_.back() != '\n' ? 1 : 0);
+    }
+
+    // Calls `fn(line)` for each line, and stops once `fn` returns false; returns false in
+    // this case.
+    template<typename Fn>
+    bool for_each(Fn&& fn) const {
+        auto&& on_line = std::forward<Fn>(fn);
+        const auto tail = for_each_terminated_line(text_, on_line);
+        if (tail == std::string_view::npos) {
+            return false;
+        }
+        return tail == text_.size() || on_line(text_.substr(tail));
+    }
+
+    // Replaces content of `out` with lines, reserving space for them if possible.
+    template<typename Container>
+    void into(Container& out) const {
+        using value_type = typename Container::value_type;
+        out.clear();
+        if constexpr (has_reserve<Container>::value) {
+            out.reserve(count());
+        }
+        for_each([&out](std::string_view line) {
+            out.push_back(value_type(line));
+            return true;
+        });
+    }
+
+    template<typename Container>
+    [[nodiscard]] Container to() const {
+        Container container;
+        into(container);
+        return container;
+    }
+
+private:
+    std::string_view text_;
+};
+
+} // namespace esl::strings::detail
@@ -6,7 +6,14 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <string_view>
+#include <utility>
+
+#include "esl/detail/simd.h"
+#include "esl/macros.h"
 
 namespace esl::strings::detail {
 
@@ -18,9 +25,129 @@ constexpr char ascii_to_upper(char ch) noexcept {
     return 'a' <= ch && ch <= 'z' ? static_cast<char>('A' + ch - 'a') : ch;
 }
 
-constexpr int compare_n_ignore_ascii_case(std::string_view s1,
-                                          std::string_view s2,
-                                          std::size_t len) noexcept {
+// Folds 'A'-'Z' to 'a'-'z' for the 8 bytes packed in `word`, while retaining other bytes.
+constexpr std::uint64_t ascii_to_lower_word(std::uint64_t word) noexcept {
+    constexpr std::uint64_t ones = 0x0101010101010101ULL;
+    constexpr std::uint64_t high_bits = ones * 0x80;
+    // Per byte, the high bit of `ge_a` is set if the low 7 bits are >= 'A', and that of `gt_z`
+    // is set if they are > 'Z'; no carry crosses bytes since the low 7 bits plus the addend
+    // is less than 0x100.
+    const auto heptets = word & ~high_bits;
+    const auto ge_a = heptets + ones * (0x80 - 'A');
+    const auto gt_z = heptets + ones * (0x80 - 'Z' - 1);
+    const auto is_upper = (ge_a ^ gt_z) & ~word & high_bits;
+    return word | (is_upper >> 2);
+}
+
+// Hashes bytes as if they were ASCII lower-cased, folding and mixing 8 bytes per step.
+inline std::uint64_t hash_ignore_ascii_case(const char* data, std::size_t len) noexcept {
+    constexpr std::uint64_t k_mul = 0x9e3779b97f4a7c15ULL;
+    auto mix = [](std::uint64_t h) {
+        h ^= h >> 31;
+        h *= 0xbf58476d1ce4e5b9ULL;
+        h ^= h >> 29;
+        return h;
+    };
+
+    std::uint64_t h = len * k_mul;
+    std::size_t i = 0;
+    for (; len - i >= 8; i += 8) {
+        std::uint64_t word{0};
+        std::memcpy(&word, data + i, 8);
+        h = mix(h ^ ascii_to_lower_word(word)) * k_mul;
+    }
+
+    if (i < len) {
+        std::uint64_t word{0};
+        std::memcpy(&word, data + i, len - i);
+        h = mix(h ^ ascii_to_lower_word(word)) * k_mul;
+    }
+
+    return mix(h);
+}
+
+// Converts `len` bytes from `src` into `dest`, 64 bytes per step.
+// `dest` may equal to `src`, but the two ranges must not overlap otherwise.
+template<bool ToUpper>
+void convert_ascii_case(const char* src, std::size_t len, char* dest) noexcept {
+    namespace simd = esl::detail::simd;
+
+    std::size_t i = 0;
+#if defined(ESL_SIMD_AVX2)
+    auto convert_32 = [](__m256i v) {
+        return ToUpper ? simd::ascii_to_upper_32(v) : simd::ascii_to_lower_32(v);
+    };
+    for (; len - i >= 64; i += 64) {
+        const auto v1 = simd::load_unaligned_32(src + i);
+        const auto v2 = simd::load_unaligned_32(src + i + 32);
+        simd::store_unaligned_32(dest + i, convert_32(v1));
+        simd::store_unaligned_32(dest + i + 32, convert_32(v2));
+    }
+#endif
+#if defined(ESL_SIMD_SSE2)
+    auto convert_16 = [](__m128i v) {
+        return ToUpper ? simd::ascii_to_upper_16(v) : simd::ascii_to_lower_16(v);
+    };
+    for (; len - i >= 64; i += 64) {
+        const auto v1 = simd::load_unaligned_16(src + i);
+        const auto v2 = simd::load_unaligned_16(src + i + 16);
+        const auto v3 = simd::load_unaligned_16(src + i + 32);
+        const auto v4 = simd::load_unaligned_16(src + i + 48);
+        simd::store_unaligned_16(dest + i, convert_16(v1));
+        simd::store_unaligned_16(dest + i + 16, convert_16(v2));
+        simd::store_unaligned_16(dest + i + 32, convert_16(v3));
+        simd::store_unaligned_16(dest + i + 48, convert_16(v4));
+    }
+    for (; len - i >= 16; i += 16) {
+        simd::store_unaligned_16(dest + i, convert_16(simd::load_unaligned_16(src + i)));
+    }
+#endif
+    for (; i < len; ++i) {
+        dest[i] = ToUpper ? ascii_to_upper(src[i]) : ascii_to_lower(src[i]);
+    }
+}
+
+// Returns the index of the first byte differing after ASCII case folding, or `len` if the first
+// `len` bytes are equal.
+// Folds and compares 16 or 32 bytes per step, exiting early on the first differing block.
+inline std::size_t mismatch_ignore_ascii_case(const char* s1,
+                                              const char* s2,
+                                              std::size_t len) noexcept {
+    namespace simd = esl::detail::simd;
+
+    std::size_t i = 0;
+#if defined(ESL_SIMD_AVX2)
+    for (; len - i >= 32; i += 32) {
+        const auto v1 = simd::ascii_to_lower_32(simd::load_unaligned_32(s1 + i));
+        const auto v2 = simd::ascii_to_lower_32(simd::load_unaligned_32(s2 + i));
+        const auto diff = ~simd::to_mask_32(_mm256_cmpeq_epi8(v1, v2)) & 0xffffffffULL;
+        if (diff != 0) {
+            return i + simd::count_trailing_zeros(diff);
+        }
+    }
+#endif
+#if defined(ESL_SIMD_SSE2)
+    for (; len - i >= 16; i += 16) {
+        const auto v1 = simd::ascii_to_lower_16(simd::load_unaligned_16(s1 + i));
+        const auto v2 = simd::ascii_to_lower_16(simd::load_unaligned_16(s2 + i));
+        const auto diff = ~simd::to_mask_16(_mm_cmpeq_epi8(v1, v2)) & 0xffffULL;
+        if (diff != 0) {
+            return i + simd::count_trailing_zeros(diff);
+        }
+    }
+#endif
+    for (; i < len; ++i) {
+        if (ascii_to_lower(s1[i]) != ascii_to_lower(s2[i])) {
+            return i;
+        }
+    }
+    return len;
+}
+
+// Compares byte by byte; used in constant evaluation.
+constexpr int compare_n_ignore_ascii_case_scalar(std::string_view s1,
+                                                 std::string_view s2,
+                                                 std::size_t len) noexcept {
     assert(len <= std::min(s1.size(), s2.size()));
 
     for (std::size_t i = 0; i < len; ++i) {
@@ -34,4 +161,80 @@ constexpr int compare_n_ignore_ascii_case(std::string_view s1,
     return 0;
 }
 
+constexpr int compare_n_ignore_ascii_case(std::string_view s1,
+                                          std::string_view s2,
+                                          std::size_t len) noexcept {
+    if (ESL_IS_CONSTANT_EVALUATED()) {
+        return compare_n_ignore_ascii_case_scalar(s1, s2, len);
+    }
+
+    assert(len <= std::min(s1.size(), s2.size()));
+    const auto idx = mismatch_ignore_ascii_case(s1.data(), s2.data(), len);
+    return idx == len
+                   ? 0
+                   : static_cast<int>(static_cast<unsigned char>(ascii_to_lower(s1[idx]))) -
+                             static_cast<int>(static_cast<unsigned char>(ascii_to_lower(s2[idx])));
+}
+
+// Loads `sizeof(Word)` bytes from `p`, which may be unaligned.
+template<typename Word>
+ESL_FORCEINLINE Word load_word(const char* p) noexcept {
+    Word word;
+    std::memcpy(&word, p, sizeof(Word));
+    return word;
+}
+
+// Checks if `N` bytes from `p`, with bits in `mask` set, equal to `lit`, using as few
+// fixed-width loads as possible; the last load may overlap the previous one.
+// `lit` and `mask` are expected to be compile-time constants so their loads fold away.
+template<std::size_t N, typename Word>
+ESL_FORCEINLINE bool fixed_equals_words(const char* p, const char* lit, const char* mask) noexcept {
+    auto differ = [=](std::size_t off) {
+        const auto folded = load_word<Word>(p + off) | load_word<Word>(mask + off);
+        return static_cast<Word>(folded ^ load_word<Word>(lit + off));
+    };
+
+    Word diff = differ(N - sizeof(Word));
+    for (std::size_t off = 0; off + sizeof(Word) < N; off += sizeof(Word)) {
+        diff = static_cast<Word>(diff | differ(off));
+    }
+    return diff == 0;
+}
+
+template<std::size_t N>
+ESL_FORCEINLINE bool fixed_equals(const char* p, const char* lit, const char* mask) noexcept {
+    if constexpr (N >= 8) {
+        return fixed_equals_words<N, std::uint64_t>(p, lit, mask);
+    } else if constexpr (N >= 4) {
+        return fixed_equals_words<N, std::uint32_t>(p, lit, mask);
+    } else if constexpr (N >= 2) {
+        return fixed_equals_words<N, std::uint16_t>(p, lit, mask);
+    } else if constexpr (N == 1) {
+        return static_cast<char>(*p | *mask) == *lit;
+    } else {
+        return true;
+    }
+}
+
+constexpr bool is_ascii_alpha(char ch) noexcept {
+    return ('a' <= ch && ch <= 'z') || ('A' <= ch && ch <= 'Z');
+}
+
+// Bytes of a literal together with precomputed masks for case-insensitive comparison, where
+// ORing a byte with the mask lower-cases it if the literal has a letter there.
+template<char... Cs>
+struct literal_bytes {
+    static constexpr std::size_t size = sizeof...(Cs);
+    // Non-empty arrays even for empty literals.
+    static constexpr char value[size + 1] = {Cs..., '\0'};
+    static constexpr char zeros[size + 1] = {};
+    static constexpr char lower[size + 1] = {ascii_to_lower(Cs)..., '\0'};
+    static constexpr char fold_mask[size + 1] = {(is_ascii_alpha(Cs) ? '\x20' : '\0')..., '\0'};
+};
+
+template<typename Holder, template<char...> typename Literal, std::size_t... I>
+constexpr auto make_literal(std::index_sequence<I...> /*unused*/) noexcept {
+    return Literal<Holder::value()[I]...>{};
+}
+
 } // namespace esl::strings::detail
@@ -0,0 +1,177 @@
+// Copyright (c) 2026 Kingsley Chen <kingsamchen at gmail dot com>
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "esl/detail/strings_match.h"
+
+namespace esl::strings::detail {
+
+// Aho-Corasick automaton compiled into a DFA.
+// Bytes are first mapped to equivalence classes, i.e. bytes appearing in no pattern share one
+// class, which keeps the transition table as narrow as the patterns' alphabet. Case folding, if
+// required, is done by the same mapping at no extra cost.
+// The transition table is dense and row-major, so that each byte costs exactly one lookup.
+// Duplicated patterns are reported once by the first index.
+class aho_corasick {
+public:
+    using state_t = std::uint32_t;
+
+    static constexpr state_t root = 0;
+
+    // The behavior is undefined if any pattern is empty.
+    aho_corasick(const std::vector<std::string_view>& patterns, bool ignore_ascii_case) {
+        assert(patterns.size() < no_state);
+        build_classes(patterns, ignore_ascii_case);
+
+        // Build the trie with missing transitions marked.
+        lengths_.reserve(patterns.size());
+        add_state();
+        for (std::size_t idx = 0; idx < patterns.size(); ++idx) {
+            const auto pattern = patterns[idx];
+            assert(!pattern.empty());
+            lengths_.push_back(pattern.size());
+            state_t cur = root;
+            for (const char ch : pattern) {
+                const auto slot = row(cur) + class_of(ch);
+                if (delta_[slot] == no_state) {
+                    // Not to bind a reference, as adding a state grows `delta_`.
+                    const auto next = add_state();
+                    delta_[slot] = next;
+                }
+                cur = delta_[slot];
+            }
+
+            if (pattern_[cur] == no_state) {
+                pattern_[cur] = static_cast<state_t>(idx);
+            }
+        }
+
+        build_links();
+    }
+
+    // Feeds `text` to the automaton, starting from and updating `state`.
+    // Calls `fn(pattern_idx, end)` for every occurrence, overlapped ones included, where `end`
+    // is `base` plus the exclusive end position in `text`. Occurrences are reported in ascending
+    // order of `end`, and longer ones go first for the same `end`.
+    // Stops once `fn` returns false, and returns false in this case.
+    template<typename Fn>
+    bool scan(std::string_view text, state_t& state, std::size_t base, Fn&& fn) const {
+        auto&& on_match = std::forward<Fn>(fn);
+        const auto* delta = delta_.data();
+        auto cur = state;
+        for (std::size_t i = 0; i < text.size(); ++i) {
+            cur = delta[row(cur) + class_of(text[i])];
+            for (auto s = output_[cur]; s != no_state; s = output_link_[s]) {
+                if (!on_match(static_cast<std::size_t>(pattern_[s]), base + i + 1)) {
+                    state = cur;
+                    return false;
+                }
+            }
+        }
+
+        state = cur;
+        return true;
+    }
+
+    [[nodiscard]] std::size_t pattern_size(std::size_t idx) const noexcept {
+        return lengths_[idx];
+    }
+
+private:
+    static constexpr state_t no_state = std::numeric_limits<state_t>::max();
+
+    void build_classes(const std::vector<std::string_view>& patterns, bool ignore_ascii_case) {
+        // Class 0 is for bytes absent from all patterns.
+        for (const auto pattern : patterns) {
+            for (const char ch : pattern) {
+                const auto folded = ignore_ascii_case ? ascii_to_lower(ch) : ch;
+                auto& cls = classes_[static_cast<unsigned char>(folded)];
+                if (cls == 0) {
+                    cls = static_cast<std::uint16_t>(class_count_++);
+                }
+            }
+        }
+
+        if (ignore_ascii_case) {
+            for (char ch = 'A'; ch <= 'Z'; ++ch) {
+                classes_[static_cast<unsigned char>(ch)] =
+                        classes_[static_cast<unsigned char>(ascii_to_lower(ch))];
+            }
+        }
+    }
+
+    state_t add_state() {
+        const auto state = static_cast<state_t>(pattern_.size());
+        delta_.resize(delta_.size() + class_count_, no_state);
+        pattern_.push_back(no_state);
+        return state;
+    }
+
+    // Fills in missing transitions with those of the failure state, breadth-first, and chains
+    // states to the nearest suffix that completes a pattern.
+    void build_links() {
+        const auto states = pattern_.size();
+        std::vector<state_t> fail(states, root);
+        output_.assign(states, no_state);
+        output_link_.assign(states, no_state);
+
+        std::vector<state_t> queue;
+        queue.reserve(states);
+        for (std::size_t c = 0; c < class_count_; ++c) {
+            auto& next = delta_[c];
+            if (next == no_state) {
+                next = root;
+            } else {
+                queue.push_back(next);
+            }
+        }
+
+        for (std::size_t head = 0; head < queue.size(); ++head) {
+            const auto s = queue[head];
+            const auto f = fail[s];
+            output_link_[s] = output_[f];
+            output_[s] = pattern_[s] != no_state ? s : output_link_[s];
+            for (std::size_t c = 0; c < class_count_; ++c) {
+                auto& next = delta_[row(s) + c];
+                if (next == no_state) {
+                    next = delta_[row(f) + c];
+                } else {
+                    fail[next] = delta_[row(f) + c];
+                    queue.push_back(next);
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] std::size_t row(state_t state) const noexcept {
+        return static_cast<std::size_t>(state) * class_count_;
+    }
+
+    [[nodiscard]] std::size_t class_of(char ch) const noexcept {
+        return classes_[static_cast<unsigned char>(ch)];
+    }
+
+    std::uint16_t classes_[256]{};
+    std::size_t class_count_{1};
+    std::vector<state_t> delta_;
+    // Per state: index of the pattern ending here, or `no_state`.
+    std::vector<state_t> pattern_;
+    // Per state: the first state on the failure chain, itself included, that completes a pattern.
+    std::vector<state_t> output_;
+    // Per state: `output_` of its failure state, i.e. the next state completing a pattern that
+    // is a proper suffix.
+    std::vector<state_t> output_link_;
+    std::vector<std::size_t> lengths_;
+};
+
+} // namespace esl::strings::detail
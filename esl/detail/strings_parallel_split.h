@@ -0,0 +1,134 @@
+// Copyright (c) 2026 Kingsley Chen <kingsamchen at gmail dot com>
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include "esl/detail/parallel.h"
+#include "esl/detail/strings_split.h"
+
+namespace esl::strings::detail {
+
+// Delimiters located in a chunk of text.
+struct split_chunk {
+    // Start position of delimiters belonging to the chunk, in ascending order.
+    std::vector<std::size_t> delimiters;
+    // Start position of the field ended by the first delimiter of the chunk.
+    std::size_t field_start{0};
+    // Index of the field ended by the first delimiter of the chunk.
+    std::size_t first_field{0};
+};
+
+// Locates delimiters starting in `text[first, last)`, as if the scan had started at `first`.
+// Delimiters ending beyond `last` are included.
+template<typename Delimiter>
+std::vector<std::size_t> find_chunk_delimiters(std::string_view text,
+                                               const Delimiter& delim,
+                                               std::size_t first,
+                                               std::size_t last) {
+    std::vector<std::size_t> positions;
+    // A delimiter starting at or after `last` does not fit in.
+    const auto scan_end = std::min(text.size(), last + delim.size() - 1);
+    delim.for_each(text.substr(0, scan_end), first, [&positions](std::size_t pos) {
+        positions.push_back(pos);
+        return true;
+    });
+    return positions;
+}
+
+// A chunk is scanned as if no delimiter had begun before it. If a delimiter found in the
+// previous chunk actually runs into this chunk, which is possible only for multi-byte
+// delimiters, rescans from the end of that delimiter until a position found by the rescan
+// is also found by the chunk scan; then the rest of the chunk scan is correct.
+template<typename Delimiter>
+void resync_chunk(std::string_view text,
+                  const Delimiter& delim,
+                  std::size_t last,
+                  std::size_t scan_from,
+                  std::vector<std::size_t>& delimiters) {
+    std::vector<std::size_t> fixed;
+    auto it = delimiters.begin();
+    bool synced{false};
+    for (auto pos = delim.find(text, scan_from); pos < last;
+         pos = delim.find(text, pos + delim.size())) {
+        it = std::lower_bound(it, delimiters.end(), pos);
+        if (it != delimiters.end() && *it == pos) {
+            synced = true;
+            break;
+        }
+        fixed.push_back(pos);
+    }
+
+    if (synced) {
+        fixed.insert(fixed.end(), it, delimiters.end());
+    }
+    delimiters.swap(fixed);
+}
+
+// Splits `text` on up to `threads` threads, each of which scans at least `min_chunk_size`
+// bytes, into fields in the same order as a sequential split.
+template<typename Delimiter>
+std::vector<std::string_view> parallel_split(std::string_view text,
+                                             const Delimiter& delim,
+                                             std::size_t threads,
+                                             std::size_t min_chunk_size) {
+    static_assert(has_bulk_scan_v<Delimiter>, "delimiter must support bulk scanning");
+    static_assert(!split_limit<Delimiter>::limited, "limited splits are sequential");
+    static_assert(!delimiter_size<Delimiter>::variable, "delimiter must have a fixed size");
+    assert(delim.size() > 0);
+
+    const auto chunk_count = std::max<std::size_t>(
+            1, std::min(threads, text.size() / std::max<std::size_t>(min_chunk_size, 1)));
+    const auto chunk_size = text.size() / chunk_count;
+    auto chunk_first = [&](std::size_t idx) {
+        return idx * chunk_size;
+    };
+    auto chunk_last = [&](std::size_t idx) {
+        return idx + 1 == chunk_count ? text.size() : chunk_first(idx + 1);
+    };
+
+    std::vector<split_chunk> chunks(chunk_count);
+    esl::detail::parallel_for(chunk_count, [&](std::size_t idx) {
+        chunks[idx].delimiters =
+                find_chunk_delimiters(text, delim, chunk_first(idx), chunk_last(idx));
+    });
+
+    // Fixes up delimiters straddling chunk boundaries, and numbers fields.
+    std::size_t field_start{0};
+    std::size_t field_count{0};
+    for (std::size_t idx = 0; idx < chunk_count; ++idx) {
+        auto& chunk = chunks[idx];
+        if (field_start > chunk_first(idx)) {
+            resync_chunk(text, delim, chunk_last(idx), field_start, chunk.delimiters);
+        }
+
+        chunk.field_start = field_start;
+        chunk.first_field = field_count;
+        if (!chunk.delimiters.empty()) {
+            field_start = chunk.delimiters.back() + delim.size();
+            field_count += chunk.delimiters.size();
+        }
+    }
+
+    std::vector<std::string_view> fields(field_count + 1);
+    esl::detail::parallel_for(chunk_count, [&](std::size_t idx) {
+        const auto& chunk = chunks[idx];
+        auto start = chunk.field_start;
+        auto out = fields.begin() + static_cast<std::ptrdiff_t>(chunk.first_field);
+        for (const auto pos : chunk.delimiters) {
+            *out++ = text.substr(start, pos - start);
+            start = pos + delim.size();
+        }
+    });
+    fields.back() = text.substr(field_start);
+
+    return fields;
+}
+
+} // namespace esl::strings::detail
@@ -0,0 +1,236 @@
+// Copyright (c) 2026 Kingsley Chen <kingsamchen at gmail dot com>
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "esl/detail/simd.h"
+#include "esl/detail/strings_match.h"
+
+namespace esl::strings::detail {
+
+// Locates occurrences of a pattern of `len` bytes, where `len` >= 2, at or after `pos`.
+// Candidates are filtered by matching pattern's first and last bytes against whole blocks
+// at once; `verify(candidate)` then checks the remaining bytes.
+// Calls `fn(match_pos)` for each non-overlapping occurrence in ascending order, and stops once
+// `fn` returns false.
+template<typename Matcher, typename Verifier, typename Fn>
+bool scan_first_last(std::string_view text,
+                     std::size_t pos,
+                     std::size_t len,
+                     const Matcher& first,
+                     const Matcher& last,
+                     Verifier&& verifier,
+                     Fn&& fn) {
+    namespace simd = esl::detail::simd;
+
+    assert(len >= 2);
+    auto&& verify = std::forward<Verifier>(verifier);
+    auto&& on_match = std::forward<Fn>(fn);
+    if (pos > text.size() || text.size() - pos < len) {
+        return true;
+    }
+
+    const char* data = text.data();
+    std::size_t next_allowed = pos;
+    auto visit = [&](std::size_t block_pos, std::uint64_t mask) {
+        for (; mask != 0; mask = simd::clear_lowest_bit(mask)) {
+            const auto candidate = block_pos + simd::count_trailing_zeros(mask);
+            if (candidate < next_allowed || !verify(data + candidate)) {
+                continue;
+            }
+
+            if (!on_match(candidate)) {
+                return false;
+            }
+
+            next_allowed = candidate + len;
+        }
+        return true;
+    };
+
+    // Candidates are in range [pos, candidate_end).
+    const auto candidate_end = text.size() - len + 1;
+    for (; candidate_end - pos >= simd::block_size; pos += simd::block_size) {
+        const auto mask = first.block_mask(data + pos) & last.block_mask(data + pos + len - 1);
+        if (!visit(pos, mask)) {
+            return false;
+        }
+    }
+
+    if (pos == candidate_end) {
+        return true;
+    }
+
+    const auto count = candidate_end - pos;
+    return visit(pos, simd::tail_block_mask(first, data + pos, count) &
+                              simd::tail_block_mask(last, data + pos + len - 1, count));
+}
+
+// Returns the position of the first occurrence of `pattern` at or after `pos` ignoring ASCII
+// case, or `npos` if not found.
+// `first` and `last` must be built from the first and the last byte of a non-empty `pattern`.
+inline std::size_t find_ignore_ascii_case(
+        std::string_view text,
+        std::size_t pos,
+        std::string_view pattern,
+        const esl::detail::simd::char_matcher_ignore_ascii_case& first,
+        const esl::detail::simd::char_matcher_ignore_ascii_case& last) noexcept {
+    assert(!pattern.empty());
+    if (pattern.size() == 1) {
+        return esl::detail::simd::find_first(first, text, pos);
+    }
+
+    auto found = std::string_view::npos;
+    scan_first_last(
+            text, pos, pattern.size(), first, last,
+            [pattern](const char* candidate) {
+                const auto rest = pattern.size() - 2;
+                return mismatch_ignore_ascii_case(candidate + 1, pattern.data() + 1, rest) == rest;
+            },
+            [&found](std::size_t match_pos) {
+                found = match_pos;
+                return false;
+            });
+    return found;
+}
+
+// Searches a pattern prepared once at construction.
+// The strategy is picked by pattern length:
+//  - a single byte is located by block bitmasks directly.
+//  - short patterns filter candidates by comparing their first and last bytes against whole
+//    blocks at once, then verify candidates left.
+//  - long patterns use Boyer-Moore-Horspool, whose average shift grows with the length.
+// The behavior is undefined if given `pattern` is empty.
+class substring_searcher {
+    enum class strategy : std::uint8_t {
+        single_byte,
+        first_last_filter,
+        horspool
+    };
+
+    struct horspool_table {
+        std::size_t shift[256];
+    };
+
+public:
+    // Patterns at least this long are searched by Boyer-Moore-Horspool.
+    static constexpr std::size_t horspool_min_size = 32;
+
+    explicit substring_searcher(std::string_view pattern)
+        : pattern_(pattern),
+          first_(pattern.empty() ? '\0' : pattern.front()),
+          last_(pattern.empty() ? '\0' : pattern.back()) {
+        assert(!pattern_.empty());
+        if (pattern_.size() == 1) {
+            strategy_ = strategy::single_byte;
+        } else if (pattern_.size() < horspool_min_size) {
+            strategy_ = strategy::first_last_filter;
+        } else {
+            strategy_ = strategy::horspool;
+            auto table = std::make_shared<horspool_table>();
+            std::fill(std::begin(table->shift), std::end(table->shift), pattern_.size());
+            for (std::size_t i = 0; i + 1 < pattern_.size(); ++i) {
+                table->shift[static_cast<unsigned char>(pattern_[i])] = pattern_.size() - 1 - i;
+            }
+            table_ = std::move(table);
+        }
+    }
+
+    // Returns the position of the first occurrence at or after `pos`, or `npos` if not found.
+    [[nodiscard]] std::size_t find(std::string_view text, std::size_t pos) const noexcept {
+        switch (strategy_) {
+        case strategy::single_byte:
+            return esl::detail::simd::find_first(first_, text, pos);
+        case strategy::first_last_filter: {
+            auto found = std::string_view::npos;
+            scan_filtered(text, pos, [&found](std::size_t match_pos) {
+                found = match_pos;
+                return false;
+            });
+            return found;
+        }
+        case strategy::horspool:
+            return find_horspool(text, pos);
+        }
+        return std::string_view::npos;
+    }
+
+    // Calls `fn(match_pos)` for each non-overlapping occurrence at or after `pos` in ascending
+    // order, and stops once `fn` returns false.
+    template<typename Fn>
+    bool for_each(std::string_view text, std::size_t pos, Fn&& fn) const {
+        auto&& on_match = std::forward<Fn>(fn);
+        switch (strategy_) {
+        case strategy::single_byte:
+            return esl::detail::simd::for_each_match(first_, text, pos, on_match);
+        case strategy::first_last_filter:
+            return scan_filtered(text, pos, on_match);
+        case strategy::horspool:
+            for (auto p = find_horspool(text, pos); p != std::string_view::npos;
+                 p = find_horspool(text, p + pattern_.size())) {
+                if (!on_match(p)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        return true;
+    }
+
+    [[nodiscard]] const std::string& pattern() const noexcept {
+        return pattern_;
+    }
+
+private:
+    template<typename Fn>
+    bool scan_filtered(std::string_view text, std::size_t pos, Fn&& fn) const {
+        const char* pattern = pattern_.data();
+        const auto len = pattern_.size();
+        return scan_first_last(
+                text, pos, len, first_, last_,
+                [pattern, len](const char* candidate) {
+                    return std::memcmp(candidate + 1, pattern + 1, len - 2) == 0;
+                },
+                std::forward<Fn>(fn));
+    }
+
+    [[nodiscard]] std::size_t find_horspool(std::string_view text, std::size_t pos) const noexcept {
+        const auto len = pattern_.size();
+        if (pos > text.size() || text.size() - pos < len) {
+            return std::string_view::npos;
+        }
+
+        // Slide the window by its last byte.
+        const char* data = text.data();
+        for (auto tail_pos = pos + len - 1; tail_pos < text.size();) {
+            const char tail = data[tail_pos];
+            const auto start = tail_pos + 1 - len;
+            if (tail == pattern_.back() &&
+                std::memcmp(data + start, pattern_.data(), len - 1) == 0) {
+                return start;
+            }
+            tail_pos += table_->shift[static_cast<unsigned char>(tail)];
+        }
+
+        return std::string_view::npos;
+    }
+
+    std::string pattern_;
+    strategy strategy_{strategy::single_byte};
+    esl::detail::simd::char_matcher first_;
+    esl::detail::simd::char_matcher last_;
+    std::shared_ptr<const horspool_table> table_;
+};
+
+} // namespace esl::strings::detail
@@ -4,11 +4,13 @@
 
 #pragma once
 
+#include <array>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
-#include <optional>
+#include <limits>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -16,15 +18,132 @@
 #include <utility>
 #include <vector>
 
+#include "esl/detail/indexed_iterator.h"
+#include "esl/flat_string_vector.h"
+#include "esl/small_vector.h"
+
 namespace esl::strings {
 
 class by_char;
 class by_string;
+struct allow_any;
 
 namespace detail {
 
-template<typename Delimiter, typename Predicate>
+// A delimiter limits the number of splits if it provides
+//   std::size_t max_splits() const;
+// Once the limit is reached, the rest of the text is the final field.
+template<typename Delimiter, typename = void>
+struct split_limit {
+    static constexpr bool limited = false;
+
+    static std::size_t get(const Delimiter& /*unused*/) noexcept {
+        return std::string_view::npos;
+    }
+};
+
+template<typename Delimiter>
+struct split_limit<Delimiter,
+                   std::void_t<decltype(std::declval<const Delimiter&>().max_splits())>> {
+    static constexpr bool limited = true;
+
+    static std::size_t get(const Delimiter& delim) noexcept {
+        return delim.max_splits();
+    }
+};
+
+// A delimiter matching text of variable length, e.g. a run of whitespaces, provides
+//   std::size_t size_at(std::string_view text, std::size_t delim_pos) const;
+// which returns the size of the delimiter found at `delim_pos`; otherwise, `size()` is used.
+template<typename Delimiter, typename = void>
+struct delimiter_size {
+    static constexpr bool variable = false;
+
+    static std::size_t get(const Delimiter& delim,
+                           std::string_view /*unused*/,
+                           std::size_t /*unused*/) noexcept {
+        return delim.size();
+    }
+};
+
+template<typename Delimiter>
+struct delimiter_size<Delimiter,
+                      std::void_t<decltype(std::declval<const Delimiter&>().size_at(
+                              std::string_view{}, std::size_t{}))>> {
+    static constexpr bool variable = true;
+
+    static std::size_t get(const Delimiter& delim,
+                           std::string_view text,
+                           std::size_t delim_pos) noexcept {
+        return delim.size_at(text, delim_pos);
+    }
+};
+
+// Besides `bool operator()(std::string_view field) const` deciding whether to keep a field,
+// a predicate may adjust each field before the decision by providing
+//   std::string_view adjust(std::string_view field) const;
+// e.g. to trim the field, while the field is still hot in cache.
+template<typename Predicate, typename = void>
+struct has_field_adjust : std::false_type {};
+
+template<typename Predicate>
+struct has_field_adjust<Predicate,
+                        std::void_t<decltype(std::declval<const Predicate&>().adjust(
+                                std::string_view{}))>> : std::true_type {};
+
+// Adjusts `field` in place if supported, and returns true if the field is accepted.
+template<typename Predicate>
+bool accept_field(const Predicate& pred, std::string_view& field) {
+    if constexpr (has_field_adjust<Predicate>::value) {
+        field = pred.adjust(field);
+    }
+    return pred(field);
+}
+
+// Number of splits left for a delimiter limiting splits; empty for other delimiters, so that
+// iterators pay nothing for it.
+template<bool Limited>
+struct split_budget {
+    split_budget() noexcept = default;
+
+    explicit split_budget(std::size_t max_splits) noexcept
+        : splits_left(max_splits) {}
+
+    // `npos` if unlimited.
+    std::size_t splits_left{std::string_view::npos};
+
+    [[nodiscard]] bool exhausted() const noexcept {
+        return splits_left == 0;
+    }
+
+    void consume() noexcept {
+        --splits_left;
+    }
+};
+
+template<>
+struct split_budget<false> {
+    split_budget() noexcept = default;
+
+    explicit split_budget(std::size_t /*unused*/) noexcept {}
+
+    [[nodiscard]] static bool exhausted() noexcept {
+        return false;
+    }
+
+    static void consume() noexcept {}
+};
+
+// Iterates fields of `SplitView`, which provides the text, the delimiter and the predicate.
+// Produces fields from the end of the text backwards if `SplitView::reversed` is true, in which
+// case the delimiter must provide
+//   std::size_t rfind(std::string_view text, std::size_t end) const;
+// which returns the position of the last delimiter that ends at or before `end`, or `npos`.
+// The iterator holds only a pointer to the view besides the current field and offsets.
+template<typename SplitView>
 class split_iterator {
+    using delimiter_type = typename SplitView::delimiter_type;
+
     enum class scan_state : std::uint8_t {
         end = 0,
         last,
@@ -39,36 +158,21 @@ public:
     using pointer = const value_type*;
 
     // Construct an end iterator, as required by the spec.
-    split_iterator() noexcept
-        : pos_(std::string_view::npos),
-          state_(scan_state::end) {}
-
-    // Construct an explicit end iterator, i.e. bound to a string.
-    explicit split_iterator(std::string_view text) noexcept
-        : pos_(std::string_view::npos),
-          state_(scan_state::end),
-          text_(text) {}
-
-    // Construct a begin iterator.
-    split_iterator(std::string_view text, std::size_t pos, Delimiter delim, Predicate pred)
-        : pos_(pos),
-          state_(scan_state::scanning),
-          text_(text),
-          delimiter_(std::move(delim)),
-          predicate_(std::move(pred)) {
+    split_iterator() noexcept = default;
+
+    // Construct a begin iterator, where `pos` is where scanning starts, or ends if reversed.
+    // The iterator refers to `view`, which must outlive the iterator and its copies.
+    split_iterator(const SplitView& view, std::size_t pos)
+        : view_(&view),
+          pos_(pos),
+          budget_(split_limit<delimiter_type>::get(view.delimiter())),
+          state_(scan_state::scanning) {
         assert(pos_ != std::string_view::npos);
         advance();
     }
 
-    ~split_iterator() = default;
-
-    split_iterator(const split_iterator&) = default;
-
-    split_iterator(split_iterator&&) noexcept = default;
-
-    split_iterator& operator=(const split_iterator&) = default;
-
-    split_iterator& operator=(split_iterator&&) noexcept = default;
+    // Disallow referring to temporaries.
+    split_iterator(const SplitView&&, std::size_t) = delete;
 
     split_iterator& operator++() {
         advance();
@@ -100,14 +204,15 @@ public:
 private:
     void advance() {
         assert(state_ != scan_state::end);
-        assert(delimiter_.has_value());
-        assert(predicate_.has_value());
+        assert(view_ != nullptr);
 
-        if (state_ == scan_state::end || !delimiter_.has_value() || !predicate_.has_value()) {
+        // `view_` is null only in end iterator.
+        if (state_ == scan_state::end || view_ == nullptr) {
             throw std::logic_error("cannot advance an invalid split_iterator");
         }
 
-        // `delimiter_` and `predicate_` are empty only in end iterator.
+        const auto text = view_->text();
+        const auto& delim = view_->delimiter();
         do {
             if (state_ == scan_state::last) {
                 pos_ = std::string_view::npos;
@@ -115,27 +220,109 @@ private:
                 return;
             }
 
-            // `substr()` call is well behaved even if `delim_start` is `npos` or `pos_`
-            // equals to `text_.size()`.
-            auto delim_start = delimiter_->find(text_, pos_);
-            curr_ = text_.substr(pos_, delim_start - pos_);
-            if (delim_start == std::string_view::npos) {
-                pos_ = text_.size();
-                state_ = scan_state::last;
+            if constexpr (SplitView::reversed) {
+                const auto delim_start =
+                        budget_.exhausted() ? std::string_view::npos : delim.rfind(text, pos_);
+                if (delim_start == std::string_view::npos) {
+                    curr_ = text.substr(0, pos_);
+                    pos_ = 0;
+                    state_ = scan_state::last;
+                } else {
+                    const auto field_start =
+                            delim_start +
+                            delimiter_size<delimiter_type>::get(delim, text, delim_start);
+                    curr_ = text.substr(field_start, pos_ - field_start);
+                    pos_ = delim_start;
+                    budget_.consume();
+                }
             } else {
-                pos_ = delim_start + delimiter_->size();
+                // `substr()` call is well behaved even if `delim_start` is `npos` or `pos_`
+                // equals to `text.size()`.
+                const auto delim_start =
+                        budget_.exhausted() ? std::string_view::npos : delim.find(text, pos_);
+                curr_ = text.substr(pos_, delim_start - pos_);
+                if (delim_start == std::string_view::npos) {
+                    pos_ = text.size();
+                    state_ = scan_state::last;
+                } else {
+                    pos_ = delim_start +
+                           delimiter_size<delimiter_type>::get(delim, text, delim_start);
+                    budget_.consume();
+                }
             }
-        } while (!(*predicate_)(curr_));
+        } while (!accept_field(view_->predicate(), curr_));
     }
 
-    std::size_t pos_;
-    scan_state state_;
-    std::string_view text_;
+    const SplitView* view_{nullptr};
     std::string_view curr_;
-    std::optional<Delimiter> delimiter_;
-    std::optional<Predicate> predicate_;
+    std::size_t pos_{std::string_view::npos};
+    split_budget<split_limit<delimiter_type>::limited> budget_;
+    scan_state state_{scan_state::end};
 };
 
+// A delimiter supports bulk scanning if it provides
+//   template<typename Fn>
+//   bool for_each(std::string_view text, std::size_t pos, Fn&& fn) const;
+// which calls `fn(delim_pos)` for each delimiter in ascending order until `fn` returns false.
+template<typename Delimiter, typename = void>
+struct has_bulk_scan : std::false_type {};
+
+template<typename Delimiter>
+struct has_bulk_scan<
+        Delimiter,
+        std::void_t<decltype(std::declval<const Delimiter&>().for_each(
+                std::string_view{}, std::size_t{}, std::declval<bool (*)(std::size_t)>()))>>
+    : std::true_type {};
+
+template<typename Delimiter>
+constexpr bool has_bulk_scan_v = has_bulk_scan<Delimiter>::value;
+
+// Bulk scanning produces fields only from left to right.
+template<typename SplitView>
+constexpr bool can_bulk_split_v =
+        has_bulk_scan_v<typename SplitView::delimiter_type> && !SplitView::reversed;
+
+// A delimiter supports fast counting if it provides
+//   std::size_t count(std::string_view text, std::size_t pos) const;
+// which returns the number of delimiters at or after `pos` without locating each of them.
+template<typename Delimiter, typename = void>
+struct has_fast_count : std::false_type {};
+
+template<typename Delimiter>
+struct has_fast_count<Delimiter,
+                      std::void_t<decltype(std::declval<const Delimiter&>().count(
+                              std::string_view{}, std::size_t{}))>> : std::true_type {};
+
+template<typename Delimiter>
+constexpr bool has_fast_count_v = has_fast_count<Delimiter>::value;
+
+// Fields can be counted by counting delimiters only if no field is filtered out.
+template<typename SplitView>
+constexpr bool can_fast_count_v = has_fast_count_v<typename SplitView::delimiter_type> &&
+                                  std::is_same_v<typename SplitView::predicate_type, allow_any>;
+
+// Splits the whole `text` in one pass with delimiter's bulk scanning, and calls `fn(field)`
+// for each field accepted by the `pred`.
+// Stops once `fn` returns false, and returns false in this case.
+template<typename Delimiter, typename Predicate, typename Fn>
+bool bulk_split(std::string_view text, const Delimiter& delim, Predicate pred, Fn&& fn) {
+    static_assert(has_bulk_scan_v<Delimiter>);
+    auto&& on_field = std::forward<Fn>(fn);
+    std::size_t field_start{0};
+    const bool completed = delim.for_each(text, 0, [&](std::size_t delim_pos) {
+        auto field = text.substr(field_start, delim_pos - field_start);
+        field_start = delim_pos + delimiter_size<Delimiter>::get(delim, text, delim_pos);
+        return !accept_field(pred, field) || on_field(field);
+    });
+
+    if (!completed) {
+        return false;
+    }
+
+    auto field = text.substr(field_start);
+    return !accept_field(pred, field) || on_field(field);
+}
+
 template<typename T, typename = void>
 struct has_insert_fn : std::false_type {};
 
@@ -166,6 +353,10 @@ struct can_construct_container<
                         has_insert_fn<C>>>>
     : std::true_type {};
 
+// Constructed by its own specialized `construct_container`.
+template<>
+struct can_construct_container<esl::flat_string_vector> : std::true_type {};
+
 template<typename C>
 constexpr bool can_construct_container_v = can_construct_container<C>::value;
 
@@ -183,44 +374,200 @@ struct construct_container {
 };
 
 // Optimized for splitting to a `std::vector<std::string_view>`.
-// Range insertion with a pair of random access iterators can reduce reallocations
-// as possible.
+// The vector is reserved exactly if fields can be counted fast. Delimiters supporting bulk
+// scanning produce all fields in one pass; otherwise, range insertion with a pair of random
+// access iterators can reduce reallocations as possible.
 template<typename Allocator>
 struct construct_container<std::vector<std::string_view, Allocator>, std::string_view> {
     template<typename SplitView>
     std::vector<std::string_view, Allocator> operator()(const SplitView& view) const {
         std::vector<std::string_view, Allocator> vec;
-        constexpr int batch_size = 16;
-        std::string_view buf[batch_size];
-        for (auto it = view.cbegin(); it != view.cend();) {
-            int cnt = 0;
-            do {
-                buf[cnt++] = *it++;
-            } while (cnt < batch_size && it != view.cend());
-            vec.insert(vec.end(), std::begin(buf), std::next(std::begin(buf), cnt));
+        if constexpr (can_fast_count_v<SplitView>) {
+            vec.reserve(view.count());
+        }
+
+        if constexpr (can_bulk_split_v<SplitView> || can_fast_count_v<SplitView>) {
+            view.for_each([&vec](std::string_view s) {
+                vec.push_back(s);
+                return true;
+            });
+        } else {
+            constexpr int batch_size = 16;
+            std::string_view buf[batch_size];
+            for (auto it = view.cbegin(); it != view.cend();) {
+                int cnt = 0;
+                do {
+                    buf[cnt++] = *it++;
+                } while (cnt < batch_size && it != view.cend());
+                vec.insert(vec.end(), std::begin(buf), std::next(std::begin(buf), cnt));
+            }
         }
         return vec;
     }
 };
 
 // Optimized for splitting to a `std::vector<std::string>`.
-// By splitting to a `std::vector<std::string_view>` first, we can reserve enough space in
-// the final vector in most cases.
+// Fields are constructed in place if they can be counted fast; otherwise, by splitting to a
+// `std::vector<std::string_view>` first, we can reserve enough space in the final vector in
+// most cases.
 template<typename Allocator>
 struct construct_container<std::vector<std::string, Allocator>, std::string> {
     template<typename SplitView>
     std::vector<std::string, Allocator> operator()(const SplitView& view) const {
-        auto vec = view.template to<std::vector<std::string_view>>();
-        return std::vector<std::string, Allocator>(vec.cbegin(), vec.cend());
+        if constexpr (can_fast_count_v<SplitView>) {
+            std::vector<std::string, Allocator> vec;
+            vec.reserve(view.count());
+            view.for_each([&vec](std::string_view s) {
+                vec.emplace_back(s);
+                return true;
+            });
+            return vec;
+        } else {
+            auto vec = view.template to<std::vector<std::string_view>>();
+            return std::vector<std::string, Allocator>(vec.cbegin(), vec.cend());
+        }
+    }
+};
+
+// Optimized for splitting to a `esl::flat_string_vector`.
+// The buffer is allocated once, since it never exceeds the text; the offset table is reserved
+// exactly if fields can be counted fast, and grows otherwise.
+template<>
+struct construct_container<esl::flat_string_vector, std::string_view> {
+    template<typename SplitView>
+    esl::flat_string_vector operator()(const SplitView& view) const {
+        esl::flat_string_vector vec;
+        if constexpr (can_fast_count_v<SplitView>) {
+            vec.reserve(view.count(), view.text().size());
+        } else {
+            vec.reserve(0, view.text().size());
+        }
+        view.for_each([&vec](std::string_view s) {
+            vec.push_back(s);
+            return true;
+        });
+        return vec;
+    }
+};
+
+// Optimized for splitting to a `esl::small_vector`.
+// Fields are appended in place, so that splits with no more than `N` fields never allocate.
+template<typename T, std::size_t N>
+struct construct_container<esl::small_vector<T, N>, T> {
+    template<typename SplitView>
+    esl::small_vector<T, N> operator()(const SplitView& view) const {
+        esl::small_vector<T, N> vec;
+        if constexpr (can_fast_count_v<SplitView>) {
+            vec.reserve(view.count());
+        }
+        view.for_each([&vec](std::string_view s) {
+            vec.emplace_back(s);
+            return true;
+        });
+        return vec;
+    }
+};
+
+// Result of splitting into caller-provided storage.
+struct split_into_result {
+    // Number of fields written.
+    std::size_t count{0};
+    // True if there were more fields than the storage could hold; the excess were dropped.
+    bool truncated{false};
+};
+
+// Immutable text shared among copies, so that copying costs O(1), and string views into the
+// text remain valid as long as any copy is alive.
+class shared_text {
+public:
+    explicit shared_text(std::string text)
+        : text_(std::make_shared<const std::string>(std::move(text))) {}
+
+    // A moved-from instance is empty.
+    explicit operator std::string_view() const noexcept {
+        return text_ ? std::string_view{*text_} : std::string_view{};
+    }
+
+private:
+    std::shared_ptr<const std::string> text_;
+};
+
+// Fields of a split text, located by 32-bit offsets computed in one pass, which provides
+// random access to fields without re-splitting.
+// The index holds a copy of the text of type `StringType`, and fields are views into it.
+template<typename StringType>
+class split_index {
+public:
+    using iterator = esl::detail::indexed_iterator<split_index>;
+    using const_iterator = iterator;
+    using value_type = std::string_view;
+    using size_type = std::size_t;
+
+    // `bounds` holds the begin and the end offsets of each field in turn.
+    split_index(StringType text, std::vector<std::uint32_t> bounds)
+        : text_(std::move(text)),
+          bounds_(std::move(bounds)) {
+        assert(bounds_.size() % 2 == 0);
+    }
+
+    [[nodiscard]] std::string_view operator[](std::size_t idx) const noexcept {
+        assert(idx < size());
+        const auto first = bounds_[idx * 2];
+        return std::string_view(text_).substr(first, bounds_[idx * 2 + 1] - first);
+    }
+
+    [[nodiscard]] std::string_view at(std::size_t idx) const {
+        if (idx >= size()) {
+            throw std::out_of_range("split_index field index out of range");
+        }
+        return (*this)[idx];
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return bounds_.size() / 2;
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return bounds_.empty();
+    }
+
+    [[nodiscard]] iterator begin() const noexcept {
+        return iterator(this, 0);
+    }
+
+    [[nodiscard]] const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    [[nodiscard]] iterator end() const noexcept {
+        return iterator(this, size());
+    }
+
+    [[nodiscard]] const_iterator cend() const noexcept {
+        return end();
+    }
+
+    [[nodiscard]] std::string_view text() const noexcept {
+        return std::string_view(text_);
     }
+
+private:
+    StringType text_;
+    std::vector<std::uint32_t> bounds_;
 };
 
 // `Delimiter` and `Predicate` should be cheap to copy.
-template<typename StringType, typename Delimiter, typename Predicate>
+// `StringType` must be explicitly convertible to `std::string_view`.
+// Iterators refer to the view, and thus must not outlive it.
+template<typename StringType, typename Delimiter, typename Predicate, bool Reverse = false>
 class split_view {
 public:
-    using const_iterator = split_iterator<Delimiter, Predicate>;
+    using const_iterator = split_iterator<split_view>;
     using iterator = const_iterator;
+    using delimiter_type = Delimiter;
+    using predicate_type = Predicate;
+
+    static constexpr bool reversed = Reverse;
 
     split_view(StringType text, Delimiter delim, Predicate pred)
         : text_(std::move(text)),
@@ -238,23 +585,23 @@ public:
     split_view& operator=(split_view&&) noexcept = default;
 
     [[nodiscard]] iterator begin() const {
-        return iterator(text_, 0, delimiter_, predicate_);
+        return iterator(*this, Reverse ? text().size() : 0);
     }
 
     [[nodiscard]] const_iterator cbegin() const {
         return begin();
     }
 
-    [[nodiscard]] iterator end() const {
-        return iterator(text_);
+    [[nodiscard]] iterator end() const noexcept {
+        return iterator();
     }
 
-    [[nodiscard]] const_iterator cend() const {
+    [[nodiscard]] const_iterator cend() const noexcept {
         return end();
     }
 
     [[nodiscard]] std::string_view text() const noexcept {
-        return text_;
+        return std::string_view(text_);
     }
 
     [[nodiscard]] const Delimiter& delimiter() const noexcept {
@@ -271,6 +618,97 @@ public:
         return construct_container<Container, typename Container::value_type>{}(*this);
     }
 
+    // Returns the number of fields, i.e. `std::distance(begin(), end())`, without producing
+    // any field if the delimiter supports fast counting and no field is filtered out.
+    // For `by_char` and `by_any_char`, it costs a popcount per 64-byte block.
+    [[nodiscard]] std::size_t count() const {
+        if constexpr (can_fast_count_v<split_view>) {
+            return delimiter_.count(text(), 0) + 1;
+        } else {
+            std::size_t cnt{0};
+            for_each([&cnt](std::string_view) {
+                ++cnt;
+                return true;
+            });
+            return cnt;
+        }
+    }
+
+    // Locates all fields in one pass, see `split_index`.
+    // Fields are indexed in the order of iteration.
+    // Throws `std::length_error` if the text is too long for 32-bit offsets.
+    [[nodiscard]] split_index<StringType> index() const {
+        const auto str = text();
+        if (str.size() > std::numeric_limits<std::uint32_t>::max()) {
+            throw std::length_error("text is too long to index by 32-bit offsets");
+        }
+
+        std::vector<std::uint32_t> bounds;
+        for_each([str, &bounds](std::string_view field) {
+            const auto first = static_cast<std::size_t>(field.data() - str.data());
+            bounds.push_back(static_cast<std::uint32_t>(first));
+            bounds.push_back(static_cast<std::uint32_t>(first + field.size()));
+            return true;
+        });
+
+        return split_index<StringType>(text_, std::move(bounds));
+    }
+
+    // Calls `fn(field)` for each field in the order of iteration, and stops once `fn` returns
+    // false; returns false in this case.
+    // Fields are produced in one pass if the delimiter supports bulk scanning.
+    template<typename Fn>
+    bool for_each(Fn&& fn) const {
+        auto&& on_field = std::forward<Fn>(fn);
+        if constexpr (can_bulk_split_v<split_view>) {
+            return bulk_split(text(), delimiter_, predicate_, on_field);
+        } else {
+            for (const auto field : *this) {
+                if (!on_field(field)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    // Writes fields into `out[0, capacity)` without allocating, and stops if it runs out of
+    // space.
+    split_into_result into(std::string_view* out, std::size_t capacity) const {
+        split_into_result result;
+        for_each([out, capacity, &result](std::string_view field) {
+            if (result.count == capacity) {
+                result.truncated = true;
+                return false;
+            }
+            out[result.count++] = field;
+            return true;
+        });
+        return result;
+    }
+
+    template<std::size_t N>
+    split_into_result into(std::string_view (&out)[N]) const {
+        return into(out, N);
+    }
+
+    template<std::size_t N>
+    split_into_result into(std::array<std::string_view, N>& out) const {
+        return into(out.data(), N);
+    }
+
+    // Replaces content of `out` with fields, reusing its capacity, e.g. a vector reused
+    // across calls, or a container with inline storage.
+    template<typename Container>
+    void into(Container& out) const {
+        using value_type = typename Container::value_type;
+        out.clear();
+        for_each([&out](std::string_view field) {
+            out.push_back(value_type(field));
+            return true;
+        });
+    }
+
 private:
     StringType text_;
     Delimiter delimiter_;
@@ -0,0 +1,163 @@
+// Copyright (c) 2026 Kingsley Chen <kingsamchen at gmail dot com>
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "esl/detail/strings_match.h"
+
+namespace esl::strings::detail {
+
+// A read-only byte trie laid out flat: outgoing edges of a node occupy a contiguous range
+// sorted by label, and children of a node are numbered consecutively.
+// Each key maps to its index in the list given at construction; duplicated keys map to the
+// first index.
+class byte_trie {
+    struct node {
+        std::uint32_t first_edge{0};
+        std::uint16_t edge_count{0};
+        std::uint32_t value{no_value};
+    };
+
+    // Edges fewer than this are searched linearly.
+    static constexpr std::uint16_t linear_search_max = 8;
+
+public:
+    static constexpr std::uint32_t no_value = std::numeric_limits<std::uint32_t>::max();
+
+    // Keys are lower-cased for both building and walking if `ignore_ascii_case` is true.
+    byte_trie(const std::vector<std::string_view>& keys, bool ignore_ascii_case)
+        : ignore_ascii_case_(ignore_ascii_case) {
+        assert(keys.size() < no_value);
+        std::vector<std::string> folded;
+        folded.reserve(keys.size());
+        for (auto key : keys) {
+            auto& k = folded.emplace_back(key);
+            if (ignore_ascii_case_) {
+                convert_ascii_case<false>(k.data(), k.size(), k.data());
+            }
+        }
+
+        std::vector<std::uint32_t> order(folded.size());
+        std::iota(order.begin(), order.end(), std::uint32_t{0});
+        // Stable sorting keeps the first index of duplicated keys ahead.
+        std::stable_sort(order.begin(), order.end(),
+                         [&folded](std::uint32_t lhs, std::uint32_t rhs) {
+                             return folded[lhs] < folded[rhs];
+                         });
+
+        nodes_.emplace_back();
+        build(folded, order);
+    }
+
+    // Walks down along `str` from the root, and calls `fn(value, len)` for each key that is a
+    // prefix of `str`, in ascending order of length, until `fn` returns false.
+    template<typename Fn>
+    void walk(std::string_view str, Fn&& fn) const {
+        auto&& on_key = std::forward<Fn>(fn);
+        std::uint32_t cur = 0;
+        if (nodes_[cur].value != no_value && !on_key(nodes_[cur].value, std::size_t{0})) {
+            return;
+        }
+
+        for (std::size_t i = 0; i < str.size(); ++i) {
+            const auto ch = ignore_ascii_case_ ? ascii_to_lower(str[i]) : str[i];
+            cur = find_child(cur, static_cast<unsigned char>(ch));
+            if (cur == no_value) {
+                return;
+            }
+
+            if (nodes_[cur].value != no_value && !on_key(nodes_[cur].value, i + 1)) {
+                return;
+            }
+        }
+    }
+
+    [[nodiscard]] bool ignores_ascii_case() const noexcept {
+        return ignore_ascii_case_;
+    }
+
+private:
+    // Builds the trie from keys visited in sorted `order`.
+    // Nodes are expanded with an explicit stack rather than recursion, since the depth equals
+    // the length of the longest key.
+    void build(const std::vector<std::string>& keys, const std::vector<std::uint32_t>& order) {
+        // Keys `order[first, last)` share first `depth` bytes, and lead to `node_idx`.
+        struct frame {
+            std::size_t first;
+            std::size_t last;
+            std::size_t depth;
+            std::uint32_t node_idx;
+        };
+
+        std::vector<frame> pending{{0, order.size(), 0, 0}};
+        while (!pending.empty()) {
+            auto [lo, hi, depth, node_idx] = pending.back();
+            pending.pop_back();
+            if (lo < hi && keys[order[lo]].size() == depth) {
+                nodes_[node_idx].value = order[lo];
+                // Skip duplicates.
+                while (lo < hi && keys[order[lo]].size() == depth) {
+                    ++lo;
+                }
+            }
+
+            if (lo == hi) {
+                continue;
+            }
+
+            // Edges of a node are contiguous, and so are its children.
+            const auto first_edge = static_cast<std::uint32_t>(labels_.size());
+            const auto first_frame = pending.size();
+            for (auto i = lo; i < hi;) {
+                const auto label = static_cast<unsigned char>(keys[order[i]][depth]);
+                auto j = i + 1;
+                while (j < hi && static_cast<unsigned char>(keys[order[j]][depth]) == label) {
+                    ++j;
+                }
+                const auto child = static_cast<std::uint32_t>(nodes_.size());
+                nodes_.emplace_back();
+                labels_.push_back(label);
+                children_.push_back(child);
+                pending.push_back({i, j, depth + 1, child});
+                i = j;
+            }
+
+            nodes_[node_idx].first_edge = first_edge;
+            nodes_[node_idx].edge_count =
+                    static_cast<std::uint16_t>(labels_.size() - first_edge);
+            // Expands children in ascending order of labels.
+            std::reverse(pending.begin() + static_cast<std::ptrdiff_t>(first_frame),
+                         pending.end());
+        }
+    }
+
+    [[nodiscard]] std::uint32_t find_child(std::uint32_t node_idx,
+                                           unsigned char label) const noexcept {
+        const auto& n = nodes_[node_idx];
+        const auto* first = labels_.data() + n.first_edge;
+        const auto* last = first + n.edge_count;
+        const auto* it = n.edge_count < linear_search_max ? std::find(first, last, label)
+                                                          : std::lower_bound(first, last, label);
+        return it != last && *it == label ? children_[static_cast<std::size_t>(it - labels_.data())]
+                                          : no_value;
+    }
+
+    std::vector<node> nodes_;
+    std::vector<unsigned char> labels_;
+    std::vector<std::uint32_t> children_;
+    bool ignore_ascii_case_;
+};
+
+} // namespace esl::strings::detail
@@ -8,13 +8,16 @@
 #include <cerrno>
 #include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <filesystem>
 #include <string>
 #include <string_view>
 #include <system_error>
+#include <utility>
 
 #include "esl/detail/files.h"
 #include "esl/detail/secure_crt.h"
+#include "esl/detail/strings_lines.h"
 
 namespace esl {
 
@@ -78,6 +81,71 @@ inline void read_file_to_string(const std::string& path, std::string& content) {
     }
 }
 
+// Calls `fn(line)` for each line of the file, with the same lines as `strings::lines()`, and
+// stops once `fn` returns false.
+// The file is read in chunks into a buffer, which grows only to hold a line longer than it,
+// rather than read as a whole; a line is valid only during the call.
+// Lines before an error are still visited.
+template<typename Fn>
+void for_each_line(const std::string& path, Fn&& fn, std::error_code& ec) {
+    ec.clear();
+
+    auto fp = detail::fopen(path, "rb");
+    if (!fp) {
+        ec.assign(errno, std::generic_category());
+        return;
+    }
+
+    constexpr auto initial_buffer_size = static_cast<std::size_t>(1024) * 64;
+
+    auto&& on_line = std::forward<Fn>(fn);
+    std::string buf(initial_buffer_size, '\0');
+    // Bytes of an unterminated line carried over from previous reads.
+    std::size_t carried{0};
+    while (true) {
+        if (carried == buf.size()) {
+            buf.resize(buf.size() * 2);
+        }
+
+        const auto size_to_read = buf.size() - carried;
+        const auto size_read = std::fread(buf.data() + carried, 1, size_to_read, fp.get());
+        bool eof{false};
+        if (size_read != size_to_read) {
+            if (ferror(fp.get())) {
+                ec.assign(EIO, std::generic_category());
+                return;
+            }
+            eof = feof(fp.get()) != 0;
+        }
+
+        const std::string_view data(buf.data(), carried + size_read);
+        const auto tail = strings::detail::for_each_terminated_line(data, on_line);
+        if (tail == std::string_view::npos) {
+            return;
+        }
+
+        if (eof) {
+            if (tail != data.size()) {
+                on_line(data.substr(tail));
+            }
+            return;
+        }
+
+        carried = data.size() - tail;
+        std::memmove(buf.data(), buf.data() + tail, carried);
+    }
+}
+
+// Throws `std::filesystem::filesystem_error` on error.
+template<typename Fn>
+void for_each_line(const std::string& path, Fn&& fn) {
+    std::error_code ec;
+    for_each_line(path, std::forward<Fn>(fn), ec);
+    if (ec) {
+        throw std::filesystem::filesystem_error("read file error", path, ec);
+    }
+}
+
 // If file already exists, will overwrite the file.
 inline void write_to_file(const std::string& path, std::string_view content, std::error_code& ec) {
     ec.clear();
@@ -0,0 +1,136 @@
+// Copyright (c) 2026 Kingsley Chen <kingsamchen at gmail dot com>
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "esl/detail/indexed_iterator.h"
+
+namespace esl {
+
+// A sequence of strings whose bytes are stored back to back in one contiguous buffer,
+// located by an offset table.
+// Owning many short strings this way costs two allocations in total, rather than one per
+// string, and keeps them adjacent in memory.
+// Elements are accessed as `std::string_view`s, which are invalidated by any modification
+// that reallocates the buffer.
+class flat_string_vector {
+public:
+    using value_type = std::string_view;
+    using size_type = std::size_t;
+    using iterator = detail::indexed_iterator<flat_string_vector>;
+    using const_iterator = iterator;
+
+    flat_string_vector() = default;
+
+    flat_string_vector(std::initializer_list<std::string_view> il) {
+        std::size_t bytes{0};
+        for (const auto str : il) {
+            bytes += str.size();
+        }
+        reserve(il.size(), bytes);
+        for (const auto str : il) {
+            push_back(str);
+        }
+    }
+
+    // Reserves space for `count` strings of `bytes` bytes in total.
+    void reserve(std::size_t count, std::size_t bytes) {
+        ends_.reserve(count);
+        buf_.reserve(bytes);
+    }
+
+    void push_back(std::string_view str) {
+        buf_.append(str.data(), str.size());
+        ends_.push_back(buf_.size());
+    }
+
+    void pop_back() noexcept {
+        assert(!empty());
+        ends_.pop_back();
+        buf_.resize(ends_.empty() ? 0 : ends_.back());
+    }
+
+    void clear() noexcept {
+        buf_.clear();
+        ends_.clear();
+    }
+
+    [[nodiscard]] std::string_view operator[](std::size_t idx) const noexcept {
+        assert(idx < size());
+        const auto first = idx == 0 ? 0 : ends_[idx - 1];
+        return std::string_view(buf_).substr(first, ends_[idx] - first);
+    }
+
+    [[nodiscard]] std::string_view at(std::size_t idx) const {
+        if (idx >= size()) {
+            throw std::out_of_range("flat_string_vector index out of range");
+        }
+        return (*this)[idx];
+    }
+
+    [[nodiscard]] std::string_view front() const noexcept {
+        return (*this)[0];
+    }
+
+    [[nodiscard]] std::string_view back() const noexcept {
+        return (*this)[size() - 1];
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return ends_.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return ends_.empty();
+    }
+
+    // Returns total bytes of all strings.
+    [[nodiscard]] std::size_t bytes_size() const noexcept {
+        return buf_.size();
+    }
+
+    // Returns bytes of all strings concatenated.
+    [[nodiscard]] std::string_view bytes() const noexcept {
+        return buf_;
+    }
+
+    [[nodiscard]] iterator begin() const noexcept {
+        return iterator(this, 0);
+    }
+
+    [[nodiscard]] const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    [[nodiscard]] iterator end() const noexcept {
+        return iterator(this, size());
+    }
+
+    [[nodiscard]] const_iterator cend() const noexcept {
+        return end();
+    }
+
+    friend bool operator==(const flat_string_vector& lhs, const flat_string_vector& rhs) noexcept {
+        return lhs.ends_ == rhs.ends_ && lhs.buf_ == rhs.buf_;
+    }
+
+    friend bool operator!=(const flat_string_vector& lhs, const flat_string_vector& rhs) noexcept {
+        return !(lhs == rhs);
+    }
+
+private:
+    std::string buf_;
+    // End offset of each string in `buf_`; a string begins where its predecessor ends.
+    std::vector<std::size_t> ends_;
+};
+
+} // namespace esl
@@ -19,3 +19,13 @@
 #else
 #define ESL_FORCEINLINE inline
 #endif
+
+// Evaluates to true if in a constant-evaluated context, where runtime-only implementations
+// like SIMD kernels must be avoided.
+// Conservatively evaluates to true if the compiler cannot tell.
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 9) || \
+        (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define ESL_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#define ESL_IS_CONSTANT_EVALUATED() true
+#endif
@@ -0,0 +1,358 @@
+// Copyright (c) 2026 Kingsley Chen <kingsamchen at gmail dot com>
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace esl {
+
+// A vector that holds up to `N` elements in inline storage, and moves them to the heap only
+// when it grows beyond.
+// Iterators, pointers and references are invalidated by any modification that reallocates,
+// and by moving the vector while its elements are inline.
+// Moved-from vectors are empty.
+template<typename T, std::size_t N>
+class small_vector {
+    static_assert(N > 0, "inline capacity must be positive");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    static constexpr std::size_t inline_capacity = N;
+
+    small_vector() noexcept = default;
+
+    small_vector(std::initializer_list<T> il) {
+        append(il.begin(), il.end());
+    }
+
+    template<typename InputIt,
+             std::enable_if_t<std::is_base_of_v<
+                                      std::input_iterator_tag,
+                                      typename std::iterator_traits<InputIt>::iterator_category>,
+                              int> = 0>
+    small_vector(InputIt first, InputIt last) {
+        append(first, last);
+    }
+
+    small_vector(const small_vector& other) {
+        append(other.begin(), other.end());
+    }
+
+    small_vector(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        steal(other);
+    }
+
+    ~small_vector() {
+        clear();
+        release();
+    }
+
+    small_vector& operator=(const small_vector& rhs) {
+        if (this != &rhs) {
+            clear();
+            append(rhs.begin(), rhs.end());
+        }
+        return *this;
+    }
+
+    small_vector& operator=(small_vector&& rhs) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this != &rhs) {
+            clear();
+            release();
+            steal(rhs);
+        }
+        return *this;
+    }
+
+    void reserve(std::size_t new_capacity) {
+        if (new_capacity > capacity_) {
+            reallocate(new_capacity);
+        }
+    }
+
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (size_ < capacity_) {
+            ::new (static_cast<void*>(data_ + size_)) T(std::forward<Args>(args)...);
+        } else {
+            // Constructs the new element before moving the old, as `args` may refer to them.
+            const auto new_capacity = next_capacity(size_ + 1);
+            auto* buf = allocate(new_capacity);
+            try {
+                ::new (static_cast<void*>(buf + size_)) T(std::forward<Args>(args)...);
+            } catch (...) {
+                deallocate(buf, new_capacity);
+                throw;
+            }
+            adopt(buf, new_capacity, 1);
+        }
+        ++size_;
+        return back();
+    }
+
+    void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    iterator insert(const_iterator pos, const T& value) {
+        return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, T&& value) {
+        return emplace(pos, std::move(value));
+    }
+
+    template<typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        assert(begin() <= pos && pos <= end());
+        const auto idx = static_cast<std::size_t>(pos - begin());
+        emplace_back(std::forward<Args>(args)...);
+        std::rotate(begin() + idx, end() - 1, end());
+        return begin() + idx;
+    }
+
+    iterator erase(const_iterator pos) {
+        assert(begin() <= pos && pos < end());
+        const auto idx = static_cast<std::size_t>(pos - begin());
+        std::move(begin() + idx + 1, end(), begin() + idx);
+        pop_back();
+        return begin() + idx;
+    }
+
+    void pop_back() noexcept {
+        assert(!empty());
+        --size_;
+        data_[size_].~T();
+    }
+
+    void resize(std::size_t count) {
+        if (count < size_) {
+            std::destroy(data_ + count, data_ + size_);
+            size_ = count;
+        } else {
+            reserve(count);
+            std::uninitialized_value_construct(data_ + size_, data_ + count);
+            size_ = count;
+        }
+    }
+
+    void clear() noexcept {
+        std::destroy(data_, data_ + size_);
+        size_ = 0;
+    }
+
+    [[nodiscard]] T& operator[](std::size_t idx) noexcept {
+        assert(idx < size_);
+        return data_[idx];
+    }
+
+    [[nodiscard]] const T& operator[](std::size_t idx) const noexcept {
+        assert(idx < size_);
+        return data_[idx];
+    }
+
+    [[nodiscard]] T& at(std::size_t idx) {
+        if (idx >= size_) {
+            throw std::out_of_range("small_vector index out of range");
+        }
+        return data_[idx];
+    }
+
+    [[nodiscard]] const T& at(std::size_t idx) const {
+        if (idx >= size_) {
+            throw std::out_of_range("small_vector index out of range");
+        }
+        return data_[idx];
+    }
+
+    [[nodiscard]] T& front() noexcept {
+        return (*this)[0];
+    }
+
+    [[nodiscard]] const T& front() const noexcept {
+        return (*this)[0];
+    }
+
+    [[nodiscard]] T& back() noexcept {
+        return (*this)[size_ - 1];
+    }
+
+    [[nodiscard]] const T& back() const noexcept {
+        return (*this)[size_ - 1];
+    }
+
+    [[nodiscard]] T* data() noexcept {
+        return data_;
+    }
+
+    [[nodiscard]] const T* data() const noexcept {
+        return data_;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    // Returns true if elements are in the inline storage.
+    [[nodiscard]] bool is_inline() const noexcept {
+        return data_ == inline_data();
+    }
+
+    [[nodiscard]] iterator begin() noexcept {
+        return data_;
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept {
+        return data_;
+    }
+
+    [[nodiscard]] const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    [[nodiscard]] iterator end() noexcept {
+        return data_ + size_;
+    }
+
+    [[nodiscard]] const_iterator end() const noexcept {
+        return data_ + size_;
+    }
+
+    [[nodiscard]] const_iterator cend() const noexcept {
+        return end();
+    }
+
+    friend bool operator==(const small_vector& lhs, const small_vector& rhs) {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    friend bool operator!=(const small_vector& lhs, const small_vector& rhs) {
+        return !(lhs == rhs);
+    }
+
+private:
+    // Address of the inline storage, which may hold no elements; it is only used to point
+    // `data_` at the storage and to compare against it.
+    [[nodiscard]] T* inline_data() noexcept {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return reinterpret_cast<T*>(inline_buf_);
+    }
+
+    [[nodiscard]] const T* inline_data() const noexcept {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return reinterpret_cast<const T*>(inline_buf_);
+    }
+
+    static T* allocate(std::size_t count) {
+        return std::allocator<T>{}.allocate(count);
+    }
+
+    static void deallocate(T* buf, std::size_t count) noexcept {
+        std::allocator<T>{}.deallocate(buf, count);
+    }
+
+    [[nodiscard]] std::size_t next_capacity(std::size_t required) const noexcept {
+        return std::max(capacity_ * 2, required);
+    }
+
+    template<typename InputIt>
+    void append(InputIt first, InputIt last) {
+        using category = typename std::iterator_traits<InputIt>::iterator_category;
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+            reserve(size_ + static_cast<std::size_t>(std::distance(first, last)));
+        }
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+
+    // Moves current elements to the front of `buf`, which has `extra` elements constructed
+    // right after them, and takes it as the storage.
+    void adopt(T* buf, std::size_t new_capacity, std::size_t extra) {
+        try {
+            if constexpr (std::is_nothrow_move_constructible_v<T> ||
+                          !std::is_copy_constructible_v<T>) {
+                std::uninitialized_move(data_, data_ + size_, buf);
+            } else {
+                std::uninitialized_copy(data_, data_ + size_, buf);
+            }
+        } catch (...) {
+            std::destroy(buf + size_, buf + size_ + extra);
+            deallocate(buf, new_capacity);
+            throw;
+        }
+        std::destroy(data_, data_ + size_);
+        release();
+        data_ = buf;
+        capacity_ = new_capacity;
+    }
+
+    void reallocate(std::size_t new_capacity) {
+        adopt(allocate(new_capacity), new_capacity, 0);
+    }
+
+    // Frees the heap storage if any, and goes back to the inline storage.
+    // Elements must have been destroyed or moved.
+    void release() noexcept {
+        if (!is_inline()) {
+            deallocate(data_, capacity_);
+            data_ = inline_data();
+            capacity_ = N;
+        }
+    }
+
+    // Takes elements of `other`, which is left empty. This vector must be empty and inline.
+    void steal(small_vector& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (other.is_inline()) {
+            std::uninitialized_move(other.data_, other.data_ + other.size_, data_);
+            size_ = other.size_;
+            other.clear();
+        } else {
+            data_ = other.data_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inline_data();
+            other.size_ = 0;
+            other.capacity_ = N;
+        }
+    }
+
+    alignas(T) unsigned char inline_buf_[sizeof(T) * N];
+    T* data_{inline_data()};
+    std::size_t size_{0};
+    std::size_t capacity_{N};
+};
+
+} // namespace esl
@@ -4,15 +4,29 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
+#include "esl/detail/simd.h"
+#include "esl/detail/strings_csv.h"
 #include "esl/detail/strings_join.h"
+#include "esl/detail/strings_lines.h"
 #include "esl/detail/strings_match.h"
+#include "esl/detail/strings_multi_search.h"
+#include "esl/detail/strings_parallel_split.h"
+#include "esl/detail/strings_search.h"
 #include "esl/detail/strings_split.h"
+#include "esl/detail/strings_trie.h"
+#include "esl/flat_string_vector.h"
 
 namespace esl::strings {
 
@@ -45,6 +59,381 @@ constexpr bool ends_with_ignore_ascii_case(std::string_view str,
            equals_ignore_ascii_case(str.substr(str.size() - suffix.size()), suffix);
 }
 
+// A string literal encoded in its type, so that matching against it compiles into a few
+// fixed-width loads and compares. Use `ESL_STRING_LITERAL()` to make one from a string literal.
+template<char... Cs>
+struct literal {
+    static constexpr std::size_t size() noexcept {
+        return sizeof...(Cs);
+    }
+
+    static constexpr std::string_view view() noexcept {
+        return {detail::literal_bytes<Cs...>::value, sizeof...(Cs)};
+    }
+};
+
+// e.g. `starts_with(request_line, ESL_STRING_LITERAL("GET "))`
+#define ESL_STRING_LITERAL(str)                                       \
+    ([] {                                                             \
+        struct holder {                                               \
+            static constexpr std::string_view value() noexcept {      \
+                return {str, sizeof(str) - 1};                        \
+            }                                                         \
+        };                                                            \
+        using ::esl::strings::literal;                                \
+        return ::esl::strings::detail::make_literal<holder, literal>( \
+                std::make_index_sequence<holder::value().size()>{});  \
+    }())
+
+template<char... Cs>
+bool starts_with(std::string_view str, literal<Cs...> /*prefix*/) noexcept {
+    using bytes = detail::literal_bytes<Cs...>;
+    return str.size() >= bytes::size &&
+           detail::fixed_equals<bytes::size>(str.data(), bytes::value, bytes::zeros);
+}
+
+template<char... Cs>
+bool ends_with(std::string_view str, literal<Cs...> /*suffix*/) noexcept {
+    using bytes = detail::literal_bytes<Cs...>;
+    return str.size() >= bytes::size &&
+           detail::fixed_equals<bytes::size>(str.data() + str.size() - bytes::size, bytes::value,
+                                             bytes::zeros);
+}
+
+template<char... Cs>
+bool equals_ignore_ascii_case(std::string_view str, literal<Cs...> /*lit*/) noexcept {
+    using bytes = detail::literal_bytes<Cs...>;
+    return str.size() == bytes::size &&
+           detail::fixed_equals<bytes::size>(str.data(), bytes::lower, bytes::fold_mask);
+}
+
+template<char... Cs>
+bool starts_with_ignore_ascii_case(std::string_view str, literal<Cs...> /*prefix*/) noexcept {
+    using bytes = detail::literal_bytes<Cs...>;
+    return str.size() >= bytes::size &&
+           detail::fixed_equals<bytes::size>(str.data(), bytes::lower, bytes::fold_mask);
+}
+
+template<char... Cs>
+bool ends_with_ignore_ascii_case(std::string_view str, literal<Cs...> /*suffix*/) noexcept {
+    using bytes = detail::literal_bytes<Cs...>;
+    return str.size() >= bytes::size &&
+           detail::fixed_equals<bytes::size>(str.data() + str.size() - bytes::size, bytes::lower,
+                                             bytes::fold_mask);
+}
+
+// Returns the position of the first occurrence of `needle` at or after `pos` ignoring ASCII case,
+// or `npos` if not found.
+// The search never allocates; use `ignore_ascii_case_needle` to search a needle repeatedly.
+inline std::size_t find_ignore_ascii_case(std::string_view str,
+                                          std::string_view needle,
+                                          std::size_t pos = 0) noexcept {
+    if (needle.empty()) {
+        return pos <= str.size() ? pos : std::string_view::npos;
+    }
+
+    using matcher_t = esl::detail::simd::char_matcher_ignore_ascii_case;
+    return detail::find_ignore_ascii_case(str, pos, needle, matcher_t(needle.front()),
+                                          matcher_t(needle.back()));
+}
+
+inline bool contains_ignore_ascii_case(std::string_view str, std::string_view needle) noexcept {
+    return find_ignore_ascii_case(str, needle) != std::string_view::npos;
+}
+
+// A needle prepared once for case-insensitive searches across many texts.
+class ignore_ascii_case_needle {
+    using matcher_t = esl::detail::simd::char_matcher_ignore_ascii_case;
+
+public:
+    explicit ignore_ascii_case_needle(std::string needle)
+        : needle_(std::move(needle)),
+          first_(needle_.empty() ? '\0' : needle_.front()),
+          last_(needle_.empty() ? '\0' : needle_.back()) {}
+
+    // See `find_ignore_ascii_case()`.
+    [[nodiscard]] std::size_t find(std::string_view str, std::size_t pos = 0) const noexcept {
+        if (needle_.empty()) {
+            return pos <= str.size() ? pos : std::string_view::npos;
+        }
+
+        return detail::find_ignore_ascii_case(str, pos, needle_, first_, last_);
+    }
+
+    [[nodiscard]] bool contains(std::string_view str) const noexcept {
+        return find(str) != std::string_view::npos;
+    }
+
+    [[nodiscard]] const std::string& value() const noexcept {
+        return needle_;
+    }
+
+private:
+    std::string needle_;
+    matcher_t first_;
+    matcher_t last_;
+};
+
+inline std::size_t find_ignore_ascii_case(std::string_view str,
+                                          const ignore_ascii_case_needle& needle,
+                                          std::size_t pos = 0) noexcept {
+    return needle.find(str, pos);
+}
+
+inline bool contains_ignore_ascii_case(std::string_view str,
+                                       const ignore_ascii_case_needle& needle) noexcept {
+    return needle.contains(str);
+}
+
+// Hash and equality functors treating ASCII letters case-insensitively, e.g. for HTTP header
+// names as keys of unordered containers.
+// Both are transparent; lookups by `std::string_view` without creating a key require
+// heterogeneous lookup support of unordered containers, which is since C++20.
+
+struct ascii_case_insensitive_hash {
+    using is_transparent = void;
+
+    std::size_t operator()(std::string_view str) const noexcept {
+        return static_cast<std::size_t>(detail::hash_ignore_ascii_case(str.data(), str.size()));
+    }
+};
+
+struct ascii_case_insensitive_equal {
+    using is_transparent = void;
+
+    bool operator()(std::string_view lhs, std::string_view rhs) const noexcept {
+        return equals_ignore_ascii_case(lhs, rhs);
+    }
+};
+
+// A set of prefixes compiled into a byte trie, answering which of them a string starts with
+// in time proportional to the length of the string, regardless of the number of prefixes.
+// Prefixes are identified by their indices in the list given at construction.
+class prefix_set {
+public:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    explicit prefix_set(std::vector<std::string> prefixes, bool ignore_ascii_case = false)
+        : prefixes_(std::move(prefixes)),
+          trie_(std::vector<std::string_view>(prefixes_.begin(), prefixes_.end()),
+                ignore_ascii_case) {}
+
+    prefix_set(std::initializer_list<std::string_view> prefixes, bool ignore_ascii_case = false)
+        : prefix_set(std::vector<std::string>(prefixes.begin(), prefixes.end()),
+                     ignore_ascii_case) {}
+
+    // Returns the index of the longest prefix `str` starts with, or `npos` if none.
+    [[nodiscard]] std::size_t find_longest(std::string_view str) const {
+        auto found = npos;
+        trie_.walk(str, [&found](std::uint32_t idx, std::size_t) {
+            found = idx;
+            return true;
+        });
+        return found;
+    }
+
+    // Returns the index of the shortest prefix `str` starts with, or `npos` if none.
+    // This stops at the first prefix met, and is thus cheaper when any prefix suffices.
+    [[nodiscard]] std::size_t find_shortest(std::string_view str) const {
+        auto found = npos;
+        trie_.walk(str, [&found](std::uint32_t idx, std::size_t) {
+            found = idx;
+            return false;
+        });
+        return found;
+    }
+
+    [[nodiscard]] bool matches(std::string_view str) const {
+        return find_shortest(str) != npos;
+    }
+
+    [[nodiscard]] const std::string& operator[](std::size_t idx) const noexcept {
+        assert(idx < prefixes_.size());
+        return prefixes_[idx];
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return prefixes_.size();
+    }
+
+    [[nodiscard]] bool ignores_ascii_case() const noexcept {
+        return trie_.ignores_ascii_case();
+    }
+
+private:
+    std::vector<std::string> prefixes_;
+    detail::byte_trie trie_;
+};
+
+// Searches many patterns in one pass over texts, by an Aho-Corasick automaton compiled once
+// at construction. Patterns are identified by their indices in the list given at construction,
+// and duplicated ones are reported by the first index.
+// The behavior is undefined if any pattern is empty.
+class multi_pattern_searcher {
+public:
+    struct match {
+        std::size_t pattern;
+        std::size_t pos;
+
+        friend bool operator==(const match& lhs, const match& rhs) noexcept {
+            return lhs.pattern == rhs.pattern && lhs.pos == rhs.pos;
+        }
+
+        friend bool operator!=(const match& lhs, const match& rhs) noexcept {
+            return !(lhs == rhs);
+        }
+    };
+
+    // Feeds a text chunk by chunk, and reports occurrences spanning chunk boundaries as well.
+    // Positions are offsets from the start of the whole text.
+    // The searcher must outlive its streams.
+    class stream {
+    public:
+        explicit stream(const multi_pattern_searcher& searcher) noexcept
+            : searcher_(&searcher) {}
+
+        // See `multi_pattern_searcher::for_each()`.
+        template<typename Fn>
+        bool feed(std::string_view chunk, Fn&& fn) {
+            const auto base = consumed_;
+            consumed_ += chunk.size();
+            return searcher_->scan(chunk, state_, base, std::forward<Fn>(fn));
+        }
+
+        // Returns occurrences ending in `chunk`.
+        std::vector<match> feed(std::string_view chunk) {
+            std::vector<match> matches;
+            feed(chunk, [&matches](std::size_t pattern, std::size_t pos) {
+                matches.push_back(match{pattern, pos});
+                return true;
+            });
+            return matches;
+        }
+
+        // Starts over as if nothing was fed.
+        void reset() noexcept {
+            state_ = detail::aho_corasick::root;
+            consumed_ = 0;
+        }
+
+        [[nodiscard]] std::size_t consumed() const noexcept {
+            return consumed_;
+        }
+
+    private:
+        const multi_pattern_searcher* searcher_;
+        detail::aho_corasick::state_t state_{detail::aho_corasick::root};
+        std::size_t consumed_{0};
+    };
+
+    explicit multi_pattern_searcher(std::vector<std::string> patterns,
+                                    bool ignore_ascii_case = false)
+        : patterns_(std::move(patterns)),
+          automaton_(std::vector<std::string_view>(patterns_.begin(), patterns_.end()),
+                     ignore_ascii_case) {}
+
+    multi_pattern_searcher(std::initializer_list<std::string_view> patterns,
+                           bool ignore_ascii_case = false)
+        : multi_pattern_searcher(std::vector<std::string>(patterns.begin(), patterns.end()),
+                                 ignore_ascii_case) {}
+
+    // Calls `fn(pattern_idx, pos)` for every occurrence in `text`, overlapped ones included.
+    // Occurrences are reported in ascending order of their end positions, and longer ones go
+    // first if ending at the same position.
+    // Stops once `fn` returns false, and returns false in this case.
+    template<typename Fn>
+    bool for_each(std::string_view text, Fn&& fn) const {
+        auto state = detail::aho_corasick::root;
+        return scan(text, state, 0, std::forward<Fn>(fn));
+    }
+
+    [[nodiscard]] std::vector<match> find_all(std::string_view text) const {
+        std::vector<match> matches;
+        for_each(text, [&matches](std::size_t pattern, std::size_t pos) {
+            matches.push_back(match{pattern, pos});
+            return true;
+        });
+        return matches;
+    }
+
+    // Returns the occurrence that ends first, or `std::nullopt` if there is none.
+    [[nodiscard]] std::optional<match> find_first(std::string_view text) const {
+        std::optional<match> found;
+        for_each(text, [&found](std::size_t pattern, std::size_t pos) {
+            found = match{pattern, pos};
+            return false;
+        });
+        return found;
+    }
+
+    [[nodiscard]] bool contains_any(std::string_view text) const {
+        return find_first(text).has_value();
+    }
+
+    [[nodiscard]] stream make_stream() const noexcept {
+        return stream(*this);
+    }
+
+    [[nodiscard]] const std::string& operator[](std::size_t idx) const noexcept {
+        assert(idx < patterns_.size());
+        return patterns_[idx];
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return patterns_.size();
+    }
+
+private:
+    template<typename Fn>
+    bool scan(std::string_view text,
+              detail::aho_corasick::state_t& state,
+              std::size_t base,
+              Fn&& fn) const {
+        auto&& on_match = std::forward<Fn>(fn);
+        return automaton_.scan(text, state, base,
+                               [this, &on_match](std::size_t idx, std::size_t end) {
+                                   return on_match(idx, end - automaton_.pattern_size(idx));
+                               });
+    }
+
+    std::vector<std::string> patterns_;
+    detail::aho_corasick automaton_;
+};
+
+//
+// case conversion
+//
+
+// `dest` must have room for `src.size()` bytes; it may be `src.data()` for in-place conversion.
+inline void to_lower_ascii(std::string_view src, char* dest) noexcept {
+    detail::convert_ascii_case<false>(src.data(), src.size(), dest);
+}
+
+// `dest` must have room for `src.size()` bytes; it may be `src.data()` for in-place conversion.
+inline void to_upper_ascii(std::string_view src, char* dest) noexcept {
+    detail::convert_ascii_case<true>(src.data(), src.size(), dest);
+}
+
+[[nodiscard]] inline std::string to_lower_ascii(std::string_view src) {
+    std::string out(src.size(), '\0');
+    to_lower_ascii(src, out.data());
+    return out;
+}
+
+[[nodiscard]] inline std::string to_upper_ascii(std::string_view src) {
+    std::string out(src.size(), '\0');
+    to_upper_ascii(src, out.data());
+    return out;
+}
+
+inline void to_lower_ascii_inplace(std::string& str) noexcept {
+    to_lower_ascii(str, str.data());
+}
+
+inline void to_upper_ascii_inplace(std::string& str) noexcept {
+    to_upper_ascii(str, str.data());
+}
+
 //
 // join
 //
@@ -75,6 +464,29 @@ std::string join(const Container& c, std::string_view sep) {
     return out;
 }
 
+// The exact size of the result is known upfront without visiting strings.
+inline void join(const flat_string_vector& vec, std::string_view sep, std::string& out) {
+    out.clear();
+    if (vec.empty()) {
+        return;
+    }
+
+    if (sep.empty()) {
+        out.assign(vec.bytes());
+        return;
+    }
+
+    out.reserve(vec.bytes_size() + sep.size() * (vec.size() - 1));
+    detail::join_append(vec.begin(), vec.end(), sep, out,
+                        [](std::string_view value, std::string& os) { os.append(value); });
+}
+
+inline std::string join(const flat_string_vector& vec, std::string_view sep) {
+    std::string out;
+    join(vec, sep, out);
+    return out;
+}
+
 template<typename T>
 void join(std::initializer_list<T> il, std::string_view sep, std::string& out) {
     join(il.begin(), il.end(), sep, out);
@@ -139,12 +551,11 @@ std::string join(std::initializer_list<T> il, std::string_view sep, Appender&& a
 //
 
 // The behavior is undefined if given `delim` is empty.
+// The delimiter is prepared into a searcher at construction, see `detail::substring_searcher`.
 class by_string {
 public:
     explicit by_string(std::string delim)
-        : delimiter_(std::move(delim)) {
-        assert(!delimiter_.empty());
-    }
+        : searcher_(delim) {}
 
     template<typename StringViewLike,
              std::enable_if_t<std::is_same_v<StringViewLike, std::string_view>, int> = 0>
@@ -152,25 +563,55 @@ public:
         : by_string(std::string{delim}) {}
 
     [[nodiscard]] std::size_t find(std::string_view text, std::size_t pos) const noexcept {
-        return delimiter_.size() == 1 ? text.find(delimiter_[0], pos)
-                                      : text.find(delimiter_, pos);
+        return searcher_.find(text, pos);
+    }
+
+    // Returns the position of the last delimiter that ends at or before `end`, or `npos`.
+    [[nodiscard]] std::size_t rfind(std::string_view text, std::size_t end) const noexcept {
+        return text.substr(0, end).rfind(searcher_.pattern());
+    }
+
+    // See `by_char::for_each()`; occurrences of the delimiter never overlap.
+    template<typename Fn>
+    bool for_each(std::string_view text, std::size_t pos, Fn&& fn) const {
+        return searcher_.for_each(text, pos, std::forward<Fn>(fn));
     }
 
     [[nodiscard]] std::size_t size() const noexcept {
-        return delimiter_.size();
+        return searcher_.pattern().size();
     }
 
 private:
-    std::string delimiter_;
+    detail::substring_searcher searcher_;
 };
 
 class by_char {
 public:
     explicit by_char(char ch) noexcept
-        : ch_(ch) {}
+        : matcher_(ch) {}
 
     [[nodiscard]] std::size_t find(std::string_view text, std::size_t pos) const noexcept {
-        return text.find(ch_, pos);
+        return esl::detail::simd::find_first(matcher_, text, pos);
+    }
+
+    // Returns the position of the last delimiter before `end`, or `npos`.
+    // Blocks are scanned backwards, like `memrchr()`.
+    [[nodiscard]] std::size_t rfind(std::string_view text, std::size_t end) const noexcept {
+        return esl::detail::simd::find_last(matcher_, text, end);
+    }
+
+    // Calls `fn(delim_pos)` for each delimiter at or after `pos` in ascending order, and stops
+    // once `fn` returns false.
+    // Delimiters are located via a bitmask per 64-byte block, thus a whole text is scanned
+    // in one pass rather than restarting a search for every field.
+    template<typename Fn>
+    bool for_each(std::string_view text, std::size_t pos, Fn&& fn) const {
+        return esl::detail::simd::for_each_match(matcher_, text, pos, std::forward<Fn>(fn));
+    }
+
+    // Returns the number of delimiters at or after `pos`, by a popcount per 64-byte block.
+    [[nodiscard]] std::size_t count(std::string_view text, std::size_t pos) const noexcept {
+        return esl::detail::simd::count_matches(matcher_, text, pos);
     }
 
     static std::size_t size() noexcept {
@@ -178,25 +619,42 @@ public:
     }
 
 private:
-    char ch_;
+    esl::detail::simd::char_matcher matcher_;
 };
 
 // The behavior is undefined if given `delim` is empty.
+// Delimiters are precompiled into a character set at construction, thus the cost of `find()`
+// is independent of the number of delimiters.
 class by_any_char {
 public:
-    explicit by_any_char(std::string delims)
-        : delimiters_(std::move(delims)) {
-        assert(!delimiters_.empty());
-    }
+    explicit by_any_char(const std::string& delims)
+        : by_any_char(std::string_view{delims}) {}
 
     template<typename StringViewLike,
              std::enable_if_t<std::is_same_v<StringViewLike, std::string_view>, int> = 0>
     explicit by_any_char(StringViewLike delim)
-        : by_any_char(std::string{delim}) {}
+        : matcher_(delim) {
+        assert(!delim.empty());
+    }
 
     [[nodiscard]] std::size_t find(std::string_view text, std::size_t pos) const noexcept {
-        return delimiters_.size() == 1 ? text.find_first_of(delimiters_[0], pos)
-                                       : text.find_first_of(delimiters_, pos);
+        return esl::detail::simd::find_first(matcher_, text, pos);
+    }
+
+    // See `by_char::rfind()`.
+    [[nodiscard]] std::size_t rfind(std::string_view text, std::size_t end) const noexcept {
+        return esl::detail::simd::find_last(matcher_, text, end);
+    }
+
+    // See `by_char::for_each()`.
+    template<typename Fn>
+    bool for_each(std::string_view text, std::size_t pos, Fn&& fn) const {
+        return esl::detail::simd::for_each_match(matcher_, text, pos, std::forward<Fn>(fn));
+    }
+
+    // See `by_char::count()`.
+    [[nodiscard]] std::size_t count(std::string_view text, std::size_t pos) const noexcept {
+        return esl::detail::simd::count_matches(matcher_, text, pos);
     }
 
     static std::size_t size() noexcept {
@@ -204,7 +662,58 @@ public:
     }
 
 private:
-    std::string delimiters_;
+    esl::detail::simd::char_set_matcher matcher_;
+};
+
+// Splits at runs of ASCII whitespaces, i.e. " \t\n\v\f\r", where a whole run acts as one
+// delimiter; thus no field is empty, except the first or the last one if the text begins or
+// ends with whitespaces, which `skip_empty` drops.
+// Whitespaces are classified a 64-byte block at a time, and the start of every run is picked
+// out of the block mask by bit operations.
+class by_whitespace {
+public:
+    by_whitespace()
+        : matcher_(std::string_view{" \t\n\v\f\r"}) {}
+
+    // Returns the start of the first run at or after `pos`.
+    [[nodiscard]] std::size_t find(std::string_view text, std::size_t pos) const noexcept {
+        return esl::detail::simd::find_first(matcher_, text, pos);
+    }
+
+    // Returns the start of the last run that ends at or before `end`, or `npos`.
+    [[nodiscard]] std::size_t rfind(std::string_view text, std::size_t end) const noexcept {
+        auto pos = esl::detail::simd::find_last(matcher_, text, end);
+        if (pos != std::string_view::npos) {
+            while (pos > 0 && matcher_.match(text[pos - 1])) {
+                --pos;
+            }
+        }
+        return pos;
+    }
+
+    // Calls `fn(run_pos)` for the start of each run at or after `pos`, see `by_char::for_each()`.
+    template<typename Fn>
+    bool for_each(std::string_view text, std::size_t pos, Fn&& fn) const {
+        return esl::detail::simd::for_each_run(matcher_, text, pos, std::forward<Fn>(fn));
+    }
+
+    // Returns the number of runs at or after `pos`, by a popcount per 64-byte block.
+    [[nodiscard]] std::size_t count(std::string_view text, std::size_t pos) const noexcept {
+        return esl::detail::simd::count_runs(matcher_, text, pos);
+    }
+
+    // Returns the length of the run starting at `pos`.
+    [[nodiscard]] std::size_t size_at(std::string_view text, std::size_t pos) const noexcept {
+        return esl::detail::simd::run_length(matcher_, text, pos);
+    }
+
+    // Returns the minimum size of a run.
+    static std::size_t size() noexcept {
+        return 1;
+    }
+
+private:
+    esl::detail::simd::char_set_matcher matcher_;
 };
 
 // The behavior is undefined if given `len` is 0.
@@ -220,6 +729,11 @@ public:
         return next_pos < text.size() ? next_pos : std::string_view::npos;
     }
 
+    // Cuts chunks from the end when splitting in reverse, thus the first chunk may be shorter.
+    [[nodiscard]] std::size_t rfind(std::string_view /*unused*/, std::size_t end) const noexcept {
+        return end > limit_len_ ? end - limit_len_ : std::string_view::npos;
+    }
+
     static std::size_t size() noexcept {
         return 0;
     }
@@ -228,6 +742,81 @@ private:
     std::size_t limit_len_;
 };
 
+// Wraps a delimiter to split at most `limit` times, and the rest of the text becomes the
+// final field; e.g. `split("a,b,c", max_splits(',', 1))` yields "a" and "b,c".
+// Scanning stops as soon as the limit is reached.
+template<typename Delimiter>
+class limited_delimiter {
+public:
+    limited_delimiter(Delimiter delim, std::size_t limit)
+        : delimiter_(std::move(delim)),
+          limit_(limit) {}
+
+    [[nodiscard]] std::size_t find(std::string_view text, std::size_t pos) const noexcept {
+        return delimiter_.find(text, pos);
+    }
+
+    template<typename D = Delimiter>
+    [[nodiscard]] auto rfind(std::string_view text, std::size_t end) const noexcept
+            -> decltype(std::declval<const D&>().rfind(text, end)) {
+        return delimiter_.rfind(text, end);
+    }
+
+    // Available only if the underlying delimiter supports bulk scanning.
+    template<typename Fn,
+             typename D = Delimiter,
+             std::enable_if_t<detail::has_bulk_scan_v<D>, int> = 0>
+    bool for_each(std::string_view text, std::size_t pos, Fn&& fn) const {
+        if (limit_ == 0) {
+            return true;
+        }
+
+        auto&& on_delim = std::forward<Fn>(fn);
+        std::size_t count{0};
+        bool stopped_by_fn{false};
+        delimiter_.for_each(text, pos, [&](std::size_t delim_pos) {
+            if (!on_delim(delim_pos)) {
+                stopped_by_fn = true;
+                return false;
+            }
+            return ++count < limit_;
+        });
+        return !stopped_by_fn;
+    }
+
+    template<typename D = Delimiter>
+    [[nodiscard]] auto size_at(std::string_view text, std::size_t pos) const noexcept
+            -> decltype(std::declval<const D&>().size_at(text, pos)) {
+        return delimiter_.size_at(text, pos);
+    }
+
+    // Available only if the underlying delimiter supports fast counting.
+    template<typename D = Delimiter>
+    [[nodiscard]] auto count(std::string_view text, std::size_t pos) const noexcept
+            -> decltype(std::declval<const D&>().count(text, pos)) {
+        const auto cnt = delimiter_.count(text, pos);
+        return cnt < limit_ ? cnt : limit_;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return delimiter_.size();
+    }
+
+    [[nodiscard]] std::size_t max_splits() const noexcept {
+        return limit_;
+    }
+
+private:
+    Delimiter delimiter_;
+    std::size_t limit_;
+};
+
+template<typename Delimiter>
+auto max_splits(Delimiter delim, std::size_t limit) {
+    using delimiter_t = typename detail::select_delimiter<Delimiter>::type;
+    return limited_delimiter<delimiter_t>(delimiter_t(std::move(delim)), limit);
+}
+
 struct allow_any {
     bool operator()(std::string_view /*unused*/) const noexcept {
         return true;
@@ -240,6 +829,46 @@ struct skip_empty {
     }
 };
 
+// Trims characters in a set off both ends of each field while splitting, and optionally
+// drops fields that become empty; e.g. `split(" a, ,b ", ',', trim_fields(" ", true))`
+// yields "a" and "b".
+// The set is precompiled into a 256-bit bitmap, thus a character is tested by one lookup.
+class trim_fields {
+public:
+    explicit trim_fields(std::string_view chars = " \t", bool skip_empty = false) noexcept
+        : skip_empty_(skip_empty) {
+        for (const char ch : chars) {
+            const auto byte = static_cast<unsigned char>(ch);
+            bitmap_[byte / 64] |= std::uint64_t{1} << (byte % 64);
+        }
+    }
+
+    [[nodiscard]] std::string_view adjust(std::string_view field) const noexcept {
+        std::size_t first{0};
+        auto last = field.size();
+        while (first < last && contains(field[first])) {
+            ++first;
+        }
+        while (last > first && contains(field[last - 1])) {
+            --last;
+        }
+        return field.substr(first, last - first);
+    }
+
+    bool operator()(std::string_view field) const noexcept {
+        return !skip_empty_ || !field.empty();
+    }
+
+private:
+    [[nodiscard]] bool contains(char ch) const noexcept {
+        const auto byte = static_cast<unsigned char>(ch);
+        return (bitmap_[byte / 64] >> (byte % 64)) & 1;
+    }
+
+    std::uint64_t bitmap_[4]{};
+    bool skip_empty_;
+};
+
 template<typename Delimiter>
 auto split(std::string_view text, Delimiter delim) {
     using delimiter_t = typename detail::select_delimiter<Delimiter>::type;
@@ -257,6 +886,8 @@ auto split(std::string_view text, Delimiter delim, Predicate predicate) {
 // Following two functions will be selected if and only if the `text` is a rvalue
 // `std::string`; using a direct cast instead of a `std::move()` or `std::forward()`
 // call to imply this semantic behavior while avoiding potential lint issues.
+// The text is moved into a storage shared among copies of the returned view, thus copying
+// the view never copies the text, and fields remain valid while any copy is alive.
 
 template<typename Delimiter,
          typename StringType,
@@ -264,8 +895,9 @@ template<typename Delimiter,
 auto split(StringType&& text, // NOLINT(cppcoreguidelines-missing-std-forward)
            Delimiter delim) {
     using delimiter_t = typename detail::select_delimiter<Delimiter>::type;
-    return detail::split_view<std::string, delimiter_t, allow_any>(
-            static_cast<std::string&&>(text), delimiter_t(std::move(delim)), allow_any{});
+    return detail::split_view<detail::shared_text, delimiter_t, allow_any>(
+            detail::shared_text(static_cast<std::string&&>(text)), delimiter_t(std::move(delim)),
+            allow_any{});
 }
 
 template<typename Delimiter,
@@ -276,8 +908,307 @@ auto split(StringType&& text, // NOLINT(cppcoreguidelines-missing-std-forward)
            Delimiter delim,
            Predicate predicate) {
     using delimiter_t = typename detail::select_delimiter<Delimiter>::type;
-    return detail::split_view<std::string, delimiter_t, Predicate>(
-            static_cast<std::string&&>(text), delimiter_t(std::move(delim)), predicate);
+    return detail::split_view<detail::shared_text, delimiter_t, Predicate>(
+            detail::shared_text(static_cast<std::string&&>(text)), delimiter_t(std::move(delim)),
+            predicate);
+}
+
+// Same as `split()`, except fields are produced from the end of the text backwards; e.g.
+// `rsplit(path, max_splits('/', 1))` yields the last path component first.
+
+template<typename Delimiter>
+auto rsplit(std::string_view text, Delimiter delim) {
+    using delimiter_t = typename detail::select_delimiter<Delimiter>::type;
+    return detail::split_view<std::string_view, delimiter_t, allow_any, true>(
+            text, delimiter_t(std::move(delim)), allow_any{});
+}
+
+template<typename Delimiter, typename Predicate>
+auto rsplit(std::string_view text, Delimiter delim, Predicate predicate) {
+    using delimiter_t = typename detail::select_delimiter<Delimiter>::type;
+    return detail::split_view<std::string_view, delimiter_t, Predicate, true>(
+            text, delimiter_t(std::move(delim)), predicate);
+}
+
+template<typename Delimiter,
+         typename StringType,
+         std::enable_if_t<std::is_same_v<StringType, std::string>, int> = 0>
+auto rsplit(StringType&& text, // NOLINT(cppcoreguidelines-missing-std-forward)
+            Delimiter delim) {
+    using delimiter_t = typename detail::select_delimiter<Delimiter>::type;
+    return detail::split_view<detail::shared_text, delimiter_t, allow_any, true>(
+            detail::shared_text(static_cast<std::string&&>(text)), delimiter_t(std::move(delim)),
+            allow_any{});
+}
+
+template<typename Delimiter,
+         typename StringType,
+         typename Predicate,
+         std::enable_if_t<std::is_same_v<StringType, std::string>, int> = 0>
+auto rsplit(StringType&& text, // NOLINT(cppcoreguidelines-missing-std-forward)
+            Delimiter delim,
+            Predicate predicate) {
+    using delimiter_t = typename detail::select_delimiter<Delimiter>::type;
+    return detail::split_view<detail::shared_text, delimiter_t, Predicate, true>(
+            detail::shared_text(static_cast<std::string&&>(text)), delimiter_t(std::move(delim)),
+            predicate);
+}
+
+struct parallel_split_options {
+    // Maximum number of threads, the calling thread included; 0 for the hardware concurrency.
+    std::size_t threads{0};
+    // Minimum number of bytes for a thread to scan; a shorter text takes fewer threads.
+    std::size_t min_chunk_size{std::size_t{1} << 20};
+};
+
+// Splits a large `text` into the same fields as `split(text, delim).to<std::vector<...>>()`,
+// by scanning chunks of the text on multiple threads.
+// Delimiters straddling chunk boundaries are handled; for a multi-byte delimiter that may
+// overlap itself, e.g. "aa", the chunk after it is partly rescanned.
+// The delimiter must support bulk scanning, e.g. `by_char`, `by_any_char` and `by_string`,
+// and must not limit splits.
+template<typename Delimiter>
+std::vector<std::string_view> parallel_split(std::string_view text,
+                                             Delimiter delim,
+                                             const parallel_split_options& options = {}) {
+    using delimiter_t = typename detail::select_delimiter<Delimiter>::type;
+    const auto threads =
+            options.threads == 0 ? esl::detail::hardware_concurrency() : options.threads;
+    return detail::parallel_split(text, delimiter_t(std::move(delim)), threads,
+                                  options.min_chunk_size);
+}
+
+// Fields are filtered by `predicate` after splitting.
+template<typename Delimiter,
+         typename Predicate,
+         std::enable_if_t<!std::is_same_v<Predicate, parallel_split_options>, int> = 0>
+std::vector<std::string_view> parallel_split(std::string_view text,
+                                             Delimiter delim,
+                                             Predicate predicate,
+                                             const parallel_split_options& options = {}) {
+    auto fields = parallel_split(text, std::move(delim), options);
+    auto kept = fields.begin();
+    for (auto field : fields) {
+        if (detail::accept_field(predicate, field)) {
+            *kept++ = field;
+        }
+    }
+    fields.erase(kept, fields.end());
+    return fields;
+}
+
+// Splits a text fed chunk by chunk, e.g. read from a file piece by piece, into the same
+// fields as `split()`, and emits every field as soon as it completes.
+// Fields within a chunk are views into the chunk; only a field spanning chunks is copied into
+// an internal buffer, thus memory is bounded by the longest field rather than the whole text.
+// A multi-byte delimiter spanning chunks is recognized as well.
+// The delimiter must have a fixed non-zero size, which rules out `by_length` and
+// `by_whitespace`, and must not limit splits.
+template<typename Delimiter, typename Predicate = allow_any>
+class split_stream {
+    static_assert(!detail::split_limit<Delimiter>::limited, "limited splits are not supported");
+    static_assert(!detail::delimiter_size<Delimiter>::variable,
+                  "delimiter must have a fixed size");
+
+public:
+    template<typename D,
+             std::enable_if_t<!std::is_same_v<std::decay_t<D>, split_stream>, int> = 0>
+    explicit split_stream(D&& delim, Predicate pred = Predicate{})
+        : delimiter_(std::forward<D>(delim)),
+          predicate_(std::move(pred)) {
+        assert(delimiter_.size() > 0);
+    }
+
+    // Calls `fn(field)` for every field completed by `chunk`; a field is valid only during
+    // the call.
+    // Stops once `fn` returns false, and returns false in this case; the rest of the chunk is
+    // discarded, and the stream should be reset before reuse.
+    template<typename Fn>
+    bool feed(std::string_view chunk, Fn&& fn) {
+        auto&& on_field = std::forward<Fn>(fn);
+        consumed_ += chunk.size();
+        auto emit = [this, &on_field](std::string_view field) {
+            return !detail::accept_field(predicate_, field) || on_field(field);
+        };
+
+        std::size_t field_start{0};
+        if (!pending_.empty()) {
+            const auto delim_end = complete_pending(chunk);
+            if (delim_end == std::string_view::npos) {
+                pending_.append(chunk.data(), chunk.size());
+                return true;
+            }
+
+            const bool go_on = emit(pending_);
+            pending_.clear();
+            if (!go_on) {
+                return false;
+            }
+            field_start = delim_end;
+        }
+
+        const auto delim_size = delimiter_.size();
+        auto on_delim = [&](std::size_t delim_pos) {
+            const auto field = chunk.substr(field_start, delim_pos - field_start);
+            field_start = delim_pos + delim_size;
+            return emit(field);
+        };
+
+        bool completed{true};
+        if constexpr (detail::has_bulk_scan_v<Delimiter>) {
+            completed = delimiter_.for_each(chunk, field_start, on_delim);
+        } else {
+            for (auto pos = delimiter_.find(chunk, field_start); pos != std::string_view::npos;
+                 pos = delimiter_.find(chunk, field_start)) {
+                if (!on_delim(pos)) {
+                    completed = false;
+                    break;
+                }
+            }
+        }
+
+        if (!completed) {
+            return false;
+        }
+
+        pending_.assign(chunk.data() + field_start, chunk.size() - field_start);
+        return true;
+    }
+
+    // Returns fields completed by `chunk`.
+    std::vector<std::string> feed(std::string_view chunk) {
+        std::vector<std::string> fields;
+        feed(chunk, [&fields](std::string_view field) {
+            fields.emplace_back(field);
+            return true;
+        });
+        return fields;
+    }
+
+    // Emits the final field, i.e. the text after the last delimiter, and resets the stream.
+    // Returns what `fn` returns, or true if the final field is filtered out.
+    template<typename Fn>
+    bool finish(Fn&& fn) {
+        auto&& on_field = std::forward<Fn>(fn);
+        std::string_view field(pending_);
+        const bool go_on = !detail::accept_field(predicate_, field) || on_field(field);
+        reset();
+        return go_on;
+    }
+
+    // Returns the final field, or `std::nullopt` if it is filtered out.
+    std::optional<std::string> finish() {
+        std::optional<std::string> field;
+        finish([&field](std::string_view str) {
+            field.emplace(str);
+            return true;
+        });
+        return field;
+    }
+
+    // Starts over as if nothing was fed.
+    void reset() noexcept {
+        pending_.clear();
+        consumed_ = 0;
+    }
+
+    // Returns the number of bytes fed so far.
+    [[nodiscard]] std::size_t consumed() const noexcept {
+        return consumed_;
+    }
+
+    // Returns the size of the incomplete field carried over.
+    [[nodiscard]] std::size_t pending_size() const noexcept {
+        return pending_.size();
+    }
+
+private:
+    // Looks for the delimiter that ends the pending field, and appends the part of `chunk`
+    // before the delimiter to the pending field.
+    // Returns the end of the delimiter in `chunk`, or `npos` if the field is still incomplete.
+    std::size_t complete_pending(std::string_view chunk) {
+        // A delimiter found within pending bytes would have ended the field, thus the first
+        // delimiter either starts in the last `delim_size - 1` pending bytes or in `chunk`.
+        const auto delim_size = delimiter_.size();
+        if (const auto tail = std::min(pending_.size(), delim_size - 1); tail > 0) {
+            std::string bridge(pending_, pending_.size() - tail);
+            bridge.append(chunk.data(), std::min(chunk.size(), delim_size - 1));
+            if (const auto pos = delimiter_.find(bridge, 0); pos < tail) {
+                pending_.resize(pending_.size() - tail + pos);
+                return pos + delim_size - tail;
+            }
+        }
+
+        const auto pos = delimiter_.find(chunk, 0);
+        if (pos == std::string_view::npos) {
+            return pos;
+        }
+        pending_.append(chunk.data(), pos);
+        return pos + delim_size;
+    }
+
+    Delimiter delimiter_;
+    Predicate predicate_;
+    std::string pending_;
+    std::size_t consumed_{0};
+};
+
+template<typename D>
+split_stream(D) -> split_stream<typename detail::select_delimiter<D>::type>;
+
+template<typename D, typename Predicate>
+split_stream(D, Predicate) -> split_stream<typename detail::select_delimiter<D>::type, Predicate>;
+
+//
+// lines
+//
+
+// Returns a view of lines in `text`, where lines are terminated by "\n" or "\r\n", and
+// terminators are excluded; e.g. "a\r\n\nb" has lines "a", "" and "b".
+// A text ending with a terminator has no empty line after it, and an empty text has no lines.
+// Newlines are located by SIMD scanning, a 64-byte block at a time.
+[[nodiscard]] inline detail::line_view lines(std::string_view text) noexcept {
+    return detail::line_view(text);
+}
+
+// Disallow viewing a temporary string.
+template<typename StringType,
+         std::enable_if_t<std::is_same_v<StringType, std::string>, int> = 0>
+detail::line_view lines(StringType&& text) = delete;
+
+//
+// csv
+//
+
+struct csv_dialect {
+    // Separator between fields, e.g. ',' for CSV or '\t' for TSV.
+    char separator{','};
+    char quote{'"'};
+};
+
+// Calls `fn(field, record_end)` for each field of CSV `text` in order, where `record_end` is
+// true for the last field of a record, and stops once `fn` returns false; returns false in
+// this case.
+// Fields are separated by `dialect.separator`, and records are terminated by "\n" or "\r\n",
+// except within quotes; e.g. `a,"b,""c"""` has fields "a" and `b,"c"`.
+// A field is a view into `text` with its enclosing quotes removed; only a field whose
+// `escaped` is true has escaped quotes in `field.raw`, and `field.value()` unescapes them.
+// The last record may be unterminated; a text ending with a terminator has no empty record
+// after it, and an empty text has no records.
+// Boundaries are found a 64-byte block at a time, and quoting is resolved by a prefix XOR over
+// the quote mask of each block rather than a byte-by-byte state machine.
+template<typename Fn>
+bool for_each_csv_field(std::string_view text, Fn&& fn, const csv_dialect& dialect = {}) {
+    return detail::for_each_csv_field(text, 0, dialect.separator, dialect.quote,
+                                      std::forward<Fn>(fn));
+}
+
+// Same as `for_each_csv_field()`, except `fn(fields)` is called for each record, with fields
+// in a `std::vector` valid only during the call.
+template<typename Fn>
+bool for_each_csv_record(std::string_view text, Fn&& fn, const csv_dialect& dialect = {}) {
+    return detail::for_each_csv_record(text, dialect.separator, dialect.quote,
+                                       std::forward<Fn>(fn));
 }
 
 //
@@ -0,0 +1,157 @@
+// Copyright (c) 2026 Kingsley Chen <kingsamchen at gmail dot com>
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include "doctest/doctest.h"
+
+#include "esl/csv.h"
+
+#include "tests/stringification.h"
+
+namespace {
+
+using esl::csv_error;
+using esl::csv_type;
+
+using error_list = std::vector<std::tuple<std::size_t, std::size_t, csv_error>>;
+
+error_list errors_of(const esl::csv_table& table) {
+    error_list errors;
+    for (const auto& err : table.errors()) {
+        errors.emplace_back(err.record, err.column, err.error);
+    }
+    return errors;
+}
+
+TEST_SUITE_BEGIN("csv");
+
+TEST_CASE("load typed columns") {
+    const std::string text =
+            "id,score,name\r\n"
+            "1,2.5,alice\r\n"
+            "-42,\"1e3\",\"b,\"\"ob\"\"\"\r\n"
+            "9223372036854775807,-0.125,";
+    esl::csv_load_options options;
+    options.has_header = true;
+    const auto table =
+            esl::load_csv(text, {csv_type::int64, csv_type::float64, csv_type::string}, options);
+
+    CHECK_EQ(table.header(), std::vector<std::string>{"id", "score", "name"});
+    REQUIRE_EQ(table.columns(), 3);
+    CHECK_EQ(table.rows(), 3);
+    CHECK(table.errors().empty());
+    CHECK_EQ(table.column_type(1), csv_type::float64);
+    CHECK_EQ(table.column<std::int64_t>(0),
+             std::vector<std::int64_t>{1, -42, 9223372036854775807});
+    CHECK_EQ(table.column<double>(1), std::vector<double>{2.5, 1000.0, -0.125});
+
+    const auto& names = table.column<std::string_view>(2);
+    CHECK_EQ(names, std::vector<std::string_view>{"alice", "b,\"ob\"", ""});
+    // Unescaped values are owned by the table, and other values are views into the text.
+    CHECK_EQ(names[0].data(), text.data() + text.find("alice"));
+
+    CHECK_THROWS_AS(table.column<double>(0), std::invalid_argument);
+    CHECK_THROWS_AS(table.column<std::int64_t>(3), std::out_of_range);
+}
+
+TEST_CASE("report errors per record and go on") {
+    const std::string_view text =
+            "1,0.5\n"
+            "x,1.5\n"
+            "2\n"
+            "3,2.5,extra\n"
+            "99999999999999999999,3.5\n"
+            "4,\n"
+            "5, 4.5\n"
+            "6,5.5\n";
+    const auto table = esl::load_csv(text, {csv_type::int64, csv_type::float64});
+    CHECK_EQ(table.column<std::int64_t>(0), std::vector<std::int64_t>{1, 6});
+    CHECK_EQ(table.column<double>(1), std::vector<double>{0.5, 5.5});
+    CHECK_EQ(errors_of(table), error_list{{1, 0, csv_error::invalid_value},
+                                          {2, 1, csv_error::too_few_fields},
+                                          {3, 2, csv_error::too_many_fields},
+                                          {4, 0, csv_error::value_out_of_range},
+                                          {5, 1, csv_error::invalid_value},
+                                          {6, 1, csv_error::invalid_value}});
+
+    const auto empty = esl::load_csv("", {csv_type::string});
+    CHECK_EQ(empty.rows(), 0);
+    CHECK(empty.errors().empty());
+}
+
+TEST_CASE("load chunks on multiple threads") {
+    std::string text = "id,comment,value\n";
+    for (int i = 0; i < 3000; ++i) {
+        const auto id = std::to_string(i);
+        text.append(id).append(",");
+        switch (i % 5) {
+        case 0:
+            text.append("\"multi\nline, \"\"quoted\"\" comment\"");
+            break;
+        case 1:
+            text.append("\"\"");
+            break;
+        case 2:
+            text.append("plain");
+            break;
+        case 3:
+            text.append("\"x\",").append(id);
+            break;
+        default:
+            text.append("\"y\r\n\"");
+            break;
+        }
+        text.append(i % 7 == 0 ? ",bad\r\n" : ",").append(i % 7 == 0 ? "" : id + ".5\n");
+    }
+
+    const std::vector<csv_type> schema{csv_type::int64, csv_type::string, csv_type::float64};
+    esl::csv_load_options options;
+    options.has_header = true;
+    const auto expected = esl::load_csv(text, schema, options);
+    CHECK_GT(expected.rows(), 2000);
+    CHECK_FALSE(expected.errors().empty());
+
+    for (std::size_t threads = 2; threads <= 8; threads += 3) {
+        options.threads = threads;
+        options.min_chunk_size = 64;
+        const auto table = esl::load_csv(text, schema, options);
+        CHECK_EQ(table.header(), expected.header());
+        CHECK_EQ(table.column<std::int64_t>(0), expected.column<std::int64_t>(0));
+        CHECK_EQ(table.column<std::string_view>(1), expected.column<std::string_view>(1));
+        CHECK_EQ(table.column<double>(2), expected.column<double>(2));
+        CHECK_EQ(errors_of(table), errors_of(expected));
+    }
+}
+
+TEST_CASE("keep unescaped values of every chunk") {
+    std::string text;
+    std::vector<std::string> expected;
+    for (int i = 0; i < 2000; ++i) {
+        const auto id = std::to_string(i);
+        text.append("\"v\"\"").append(id).append("\"\n");
+        expected.push_back("v\"" + id);
+    }
+
+    esl::csv_load_options options;
+    options.threads = 8;
+    options.min_chunk_size = 64;
+    const auto table = esl::load_csv(text, {csv_type::string}, options);
+    CHECK(table.errors().empty());
+    const auto& values = table.column<std::string_view>(0);
+    REQUIRE_EQ(values.size(), expected.size());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        CHECK_EQ(values[i], expected[i]);
+    }
+}
+
+TEST_SUITE_END();
+
+} // namespace
@@ -7,11 +7,13 @@
 #include <string>
 #include <string_view>
 #include <system_error>
+#include <vector>
 
 #include "doctest/doctest.h"
 
 #include "esl/file_util.h"
 #include "esl/strings.h"
+#include "tests/stringification.h"
 #include "tests/test_util.h"
 
 namespace fs = std::filesystem;
@@ -84,6 +86,44 @@ TEST_CASE("read file that does not exist") {
     CHECK(content.empty());
 }
 
+TEST_CASE("read file line by line") {
+    auto file = tests::new_test_filepath();
+    CAPTURE(file);
+
+    SUBCASE("same as lines of the whole content") {
+        std::string content;
+        for (int i = 0; i < 20000; ++i) {
+            content.append(std::to_string(i)).append(i % 2 == 0 ? "\r\n" : "\n");
+        }
+        // Longer than the read buffer.
+        content.append(200000, 'x').append("\r\nlast");
+        esl::write_to_file(file, content);
+
+        std::vector<std::string> lines;
+        esl::for_each_line(file, [&lines](std::string_view line) {
+            lines.emplace_back(line);
+            return true;
+        });
+        CHECK(lines == esl::strings::lines(content).to<std::vector<std::string>>());
+    }
+
+    SUBCASE("stop early") {
+        esl::write_to_file(file, "a\nb\nc\n");
+        std::vector<std::string> lines;
+        esl::for_each_line(file, [&lines](std::string_view line) {
+            lines.emplace_back(line);
+            return line != "b";
+        });
+        CHECK_EQ(lines, std::vector<std::string>{"a", "b"});
+    }
+
+    SUBCASE("file does not exist") {
+        std::error_code ec;
+        esl::for_each_line(tests::new_test_filepath(), [](std::string_view) { return true; }, ec);
+        CHECK_EQ(ec, std::errc::no_such_file_or_directory);
+    }
+}
+
 #if !defined(_WIN32)
 
 TEST_CASE("read file that don't have read permission") {
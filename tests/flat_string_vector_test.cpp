@@ -0,0 +1,124 @@
+// Copyright (c) 2026 Kingsley Chen <kingsamchen at gmail dot com>
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "doctest/doctest.h"
+
+#include "esl/flat_string_vector.h"
+#include "esl/ignore_unused.h"
+#include "esl/strings.h"
+
+#include "tests/stringification.h"
+
+namespace strings = esl::strings;
+
+namespace {
+
+TEST_SUITE_BEGIN("flat_string_vector");
+
+TEST_CASE("basic usages") {
+    esl::flat_string_vector vec;
+    CHECK(vec.empty());
+    CHECK_EQ(vec.begin(), vec.end());
+
+    vec.push_back("foo");
+    vec.push_back("");
+    vec.push_back("barbaz");
+    REQUIRE_EQ(vec.size(), 3);
+    CHECK_EQ(vec[0], "foo");
+    CHECK_EQ(vec[1], "");
+    CHECK_EQ(vec.at(2), "barbaz");
+    CHECK_EQ(vec.front(), "foo");
+    CHECK_EQ(vec.back(), "barbaz");
+    CHECK_THROWS_AS(esl::ignore_unused(vec.at(3)), std::out_of_range);
+    CHECK_EQ(vec.bytes(), "foobarbaz");
+    CHECK_EQ(vec.bytes_size(), 9);
+
+    // Bytes are adjacent.
+    CHECK_EQ(vec[2].data(), vec[0].data() + 3);
+
+    vec.pop_back();
+    CHECK_EQ(vec.size(), 2);
+    CHECK_EQ(vec.bytes(), "foo");
+    CHECK_EQ(vec, esl::flat_string_vector{"foo", ""});
+    CHECK_NE(vec, esl::flat_string_vector{"fo", "o"});
+
+    vec.clear();
+    CHECK(vec.empty());
+    CHECK_EQ(vec.bytes_size(), 0);
+}
+
+TEST_CASE("random access iterators") {
+    using iter_t = esl::flat_string_vector::iterator;
+    static_assert(std::is_same_v<std::iterator_traits<iter_t>::iterator_category,
+                                 std::random_access_iterator_tag>);
+
+    const esl::flat_string_vector vec{"c", "a", "d", "b"};
+    CHECK_EQ(vec.end() - vec.begin(), 4);
+    CHECK_EQ(vec.begin()[2], "d");
+    CHECK_EQ(*std::prev(vec.end()), "b");
+
+    std::vector<std::string_view> sorted(vec.begin(), vec.end());
+    std::sort(sorted.begin(), sorted.end());
+    CHECK_EQ(sorted, std::vector<std::string_view>{"a", "b", "c", "d"});
+    CHECK(std::find(vec.begin(), vec.end(), "d") == vec.begin() + 2);
+}
+
+TEST_CASE("as split target") {
+    SUBCASE("bulk scan delimiters") {
+        const auto vec = strings::split("a,bb,,ccc,", ',').to<esl::flat_string_vector>();
+        CHECK_EQ(vec, esl::flat_string_vector{"a", "bb", "", "ccc", ""});
+
+        const auto skipped = strings::split(",a,,b,", ',', strings::skip_empty{})
+                                     .to<esl::flat_string_vector>();
+        CHECK_EQ(skipped, esl::flat_string_vector{"a", "b"});
+    }
+
+    SUBCASE("other delimiters") {
+        const auto vec = strings::split("abcdefg", strings::by_length(3))
+                                 .to<esl::flat_string_vector>();
+        CHECK_EQ(vec, esl::flat_string_vector{"abc", "def", "g"});
+    }
+
+    SUBCASE("owned text") {
+        const auto vec = strings::split(std::string("x y z"), ' ').to<esl::flat_string_vector>();
+        CHECK_EQ(vec, esl::flat_string_vector{"x", "y", "z"});
+    }
+    SUBCASE("predicate runs once per field") {
+        int calls = 0;
+        const auto vec = strings::split("a,b,c,d", ',', [&calls](std::string_view) {
+                             return ++calls % 2 != 0;
+                         }).to<esl::flat_string_vector>();
+        CHECK_EQ(vec, esl::flat_string_vector{"a", "c"});
+        CHECK_EQ(calls, 4);
+    }
+}
+
+TEST_CASE("as join source") {
+    const esl::flat_string_vector vec{"GET", "/index.html", "HTTP/1.1"};
+    CHECK_EQ(strings::join(vec, " "), "GET /index.html HTTP/1.1");
+    CHECK_EQ(strings::join(vec, ""), "GET/index.htmlHTTP/1.1");
+    CHECK_EQ(strings::join(vec, ", "), "GET, /index.html, HTTP/1.1");
+    CHECK_EQ(strings::join(esl::flat_string_vector{}, ","), "");
+    CHECK_EQ(strings::join(vec.begin(), vec.end(), "|"), "GET|/index.html|HTTP/1.1");
+
+    std::string out = "stale";
+    strings::join(vec, "::", out);
+    CHECK_EQ(out, "GET::/index.html::HTTP/1.1");
+
+    // Round trip.
+    const std::string text = "a;b;;c";
+    CHECK_EQ(strings::join(strings::split(text, ';').to<esl::flat_string_vector>(), ";"), text);
+}
+
+TEST_SUITE_END();
+
+} // namespace
@@ -0,0 +1,126 @@
+// Copyright (c) 2026 Kingsley Chen <kingsamchen at gmail dot com>
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "doctest/doctest.h"
+
+#include "esl/ignore_unused.h"
+#include "esl/small_vector.h"
+#include "esl/strings.h"
+
+#include "tests/stringification.h"
+
+namespace strings = esl::strings;
+
+namespace {
+
+TEST_SUITE_BEGIN("small_vector");
+
+TEST_CASE("grow beyond inline storage") {
+    esl::small_vector<std::string, 2> vec;
+    CHECK(vec.empty());
+    CHECK(vec.is_inline());
+    CHECK_EQ(vec.capacity(), 2);
+
+    vec.push_back("foo");
+    vec.emplace_back(std::size_t{3}, 'x');
+    CHECK(vec.is_inline());
+
+    // Appending an element of itself while reallocating.
+    vec.push_back(vec.front());
+    CHECK_FALSE(vec.is_inline());
+    REQUIRE_EQ(vec.size(), 3);
+    CHECK_EQ(vec[0], "foo");
+    CHECK_EQ(vec[1], "xxx");
+    CHECK_EQ(vec.at(2), "foo");
+    CHECK_THROWS_AS(esl::ignore_unused(vec.at(3)), std::out_of_range);
+
+    vec.pop_back();
+    CHECK_EQ(vec.back(), "xxx");
+    vec.clear();
+    CHECK(vec.empty());
+}
+
+TEST_CASE("insert and erase") {
+    esl::small_vector<int, 4> vec{1, 3};
+    vec.insert(vec.begin() + 1, 2);
+    vec.insert(vec.end(), 4);
+    vec.insert(vec.begin(), 0);
+    CHECK_EQ(vec, esl::small_vector<int, 4>{0, 1, 2, 3, 4});
+
+    auto it = vec.erase(vec.begin() + 2);
+    CHECK_EQ(*it, 3);
+    CHECK_EQ(vec, esl::small_vector<int, 4>{0, 1, 3, 4});
+
+    vec.resize(6);
+    CHECK_EQ(vec, esl::small_vector<int, 4>{0, 1, 3, 4, 0, 0});
+    vec.resize(1);
+    CHECK_EQ(vec, esl::small_vector<int, 4>{0});
+}
+
+TEST_CASE("copy and move") {
+    SUBCASE("inline") {
+        esl::small_vector<std::unique_ptr<int>, 2> vec;
+        vec.push_back(std::make_unique<int>(42));
+        auto moved = std::move(vec);
+        CHECK(vec.empty()); // NOLINT(bugprone-use-after-move)
+        REQUIRE_EQ(moved.size(), 1);
+        CHECK_EQ(*moved[0], 42);
+        CHECK(moved.is_inline());
+    }
+
+    SUBCASE("heap") {
+        const esl::small_vector<std::string, 1> vec{"a", "b", "c"};
+        auto copied = vec;
+        CHECK_EQ(copied, vec);
+
+        const auto* storage = copied.data();
+        auto moved = std::move(copied);
+        CHECK_EQ(moved.data(), storage);
+        CHECK(copied.empty()); // NOLINT(bugprone-use-after-move)
+        CHECK(copied.is_inline());
+
+        copied = moved;
+        CHECK_EQ(copied, vec);
+        moved = esl::small_vector<std::string, 1>{"d"};
+        CHECK_EQ(moved, esl::small_vector<std::string, 1>{"d"});
+        CHECK_NE(moved, vec);
+    }
+}
+
+TEST_CASE("as split target") {
+    SUBCASE("fit in inline storage") {
+        const auto vec = strings::split("GET /index.html HTTP/1.1", ' ')
+                                 .to<esl::small_vector<std::string_view, 4>>();
+        CHECK(vec.is_inline());
+        CHECK_EQ(vec, esl::small_vector<std::string_view, 4>{"GET", "/index.html", "HTTP/1.1"});
+    }
+
+    SUBCASE("spill to heap") {
+        const auto vec = strings::split("abcdefg", strings::by_length(2))
+                                 .to<esl::small_vector<std::string, 2>>();
+        CHECK_FALSE(vec.is_inline());
+        CHECK_EQ(vec, esl::small_vector<std::string, 2>{"ab", "cd", "ef", "g"});
+    }
+
+    SUBCASE("reuse") {
+        esl::small_vector<std::string_view, 4> vec;
+        strings::split("a,,b", ',', strings::skip_empty{}).into(vec);
+        CHECK_EQ(vec, esl::small_vector<std::string_view, 4>{"a", "b"});
+        strings::rsplit("x y z", ' ').into(vec);
+        CHECK_EQ(vec, esl::small_vector<std::string_view, 4>{"z", "y", "x"});
+        CHECK(vec.is_inline());
+    }
+}
+
+TEST_SUITE_END();
+
+} // namespace
@@ -0,0 +1,110 @@
+// Copyright (c) 2026 Kingsley Chen <kingsamchen at gmail dot com>
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "doctest/doctest.h"
+
+#include "esl/detail/strings_match.h"
+#include "esl/strings.h"
+
+namespace strings = esl::strings;
+
+namespace {
+
+// Covers every byte value and spans multiple blocks plus a tail.
+std::string make_all_bytes_text() {
+    std::string text;
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 256; ++i) {
+            text.push_back(static_cast<char>(i));
+        }
+    }
+    text.append("Tail-Of-Odd-Length");
+    return text;
+}
+
+std::string scalar_to_lower(std::string_view src) {
+    std::string out;
+    for (const char ch : src) {
+        out.push_back(strings::detail::ascii_to_lower(ch));
+    }
+    return out;
+}
+
+std::string scalar_to_upper(std::string_view src) {
+    std::string out;
+    for (const char ch : src) {
+        out.push_back(strings::detail::ascii_to_upper(ch));
+    }
+    return out;
+}
+
+TEST_SUITE_BEGIN("strings/case");
+
+TEST_CASE("convert to lower ascii") {
+    SUBCASE("normal cases") {
+        CHECK_EQ(strings::to_lower_ascii("Content-Type"), "content-type");
+        CHECK_EQ(strings::to_lower_ascii("@[`{"), "@[`{");
+        CHECK_EQ(strings::to_lower_ascii(""), "");
+    }
+
+    SUBCASE("agree with scalar helper on any length") {
+        const auto text = make_all_bytes_text();
+        for (std::size_t len = 0; len <= text.size(); len += 17) {
+            const auto src = std::string_view{text}.substr(0, len);
+            CHECK_EQ(strings::to_lower_ascii(src), scalar_to_lower(src));
+        }
+    }
+
+    SUBCASE("into caller-provided buffer") {
+        const std::string_view src = "HTTP/1.1 200 OK";
+        char buf[32]{};
+        strings::to_lower_ascii(src, buf);
+        CHECK_EQ(std::string_view(buf, src.size()), "http/1.1 200 ok");
+    }
+
+    SUBCASE("in place") {
+        auto text = make_all_bytes_text();
+        const auto expected = scalar_to_lower(text);
+        strings::to_lower_ascii_inplace(text);
+        CHECK_EQ(text, expected);
+    }
+}
+
+TEST_CASE("convert to upper ascii") {
+    SUBCASE("normal cases") {
+        CHECK_EQ(strings::to_upper_ascii("Content-Type"), "CONTENT-TYPE");
+        CHECK_EQ(strings::to_upper_ascii("@[`{"), "@[`{");
+        CHECK_EQ(strings::to_upper_ascii(""), "");
+    }
+
+    SUBCASE("agree with scalar helper on any length") {
+        const auto text = make_all_bytes_text();
+        for (std::size_t len = 0; len <= text.size(); len += 17) {
+            const auto src = std::string_view{text}.substr(0, len);
+            CHECK_EQ(strings::to_upper_ascii(src), scalar_to_upper(src));
+        }
+    }
+
+    SUBCASE("into caller-provided buffer") {
+        const std::string_view src = "http/1.1 200 ok";
+        char buf[32]{};
+        strings::to_upper_ascii(src, buf);
+        CHECK_EQ(std::string_view(buf, src.size()), "HTTP/1.1 200 OK");
+    }
+
+    SUBCASE("in place") {
+        auto text = make_all_bytes_text();
+        const auto expected = scalar_to_upper(text);
+        strings::to_upper_ascii_inplace(text);
+        CHECK_EQ(text, expected);
+    }
+}
+
+TEST_SUITE_END();
+
+} // namespace
@@ -0,0 +1,141 @@
+// Copyright (c) 2026 Kingsley Chen <kingsamchen at gmail dot com>
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <cstddef>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "doctest/doctest.h"
+
+#include "esl/strings.h"
+#include "tests/stringification.h"
+
+namespace strings = esl::strings;
+
+namespace {
+
+using record = std::vector<std::string>;
+using records = std::vector<record>;
+
+records parse_values(std::string_view text, const strings::csv_dialect& dialect = {}) {
+    records result;
+    strings::for_each_csv_record(
+            text,
+            [&result](const auto& fields) {
+                auto& rec = result.emplace_back();
+                for (const auto& field : fields) {
+                    rec.push_back(field.value());
+                }
+                return true;
+            },
+            dialect);
+    return result;
+}
+
+std::string encode(const records& recs, std::string_view terminator) {
+    std::string text;
+    for (const auto& rec : recs) {
+        for (std::size_t i = 0; i < rec.size(); ++i) {
+            const auto& value = rec[i];
+            text.append(i == 0 ? "" : ",");
+            if (value.find_first_of(",\"\r\n") == std::string::npos) {
+                text.append(value);
+                continue;
+            }
+            text.push_back('"');
+            for (const char ch : value) {
+                text.append(ch == '"' ? 2 : 1, ch);
+            }
+            text.push_back('"');
+        }
+        text.append(terminator);
+    }
+    return text;
+}
+
+} // namespace
+
+TEST_CASE("tokenize csv") {
+    SUBCASE("fields and records") {
+        CHECK_EQ(parse_values("a,b\nc,d\n"), records{{"a", "b"}, {"c", "d"}});
+        CHECK_EQ(parse_values("a,b\r\nc,d"), records{{"a", "b"}, {"c", "d"}});
+        CHECK_EQ(parse_values("a,,\n\n,b"), records{{"a", "", ""}, {""}, {"", "b"}});
+        CHECK_EQ(parse_values("a,"), records{{"a", ""}});
+        CHECK_EQ(parse_values("a\r"), records{{"a\r"}});
+        CHECK(parse_values("").empty());
+    }
+
+    SUBCASE("quoted fields") {
+        CHECK_EQ(parse_values(R"(a,"b,c","d
+e")"),
+                 records{{"a", "b,c", "d\ne"}});
+        CHECK_EQ(parse_values(R"("a""b",""""
+"",x)"),
+                 records{{"a\"b", "\""}, {"", "x"}});
+        CHECK_EQ(parse_values("\"a\"\r\n\"b\r\n\"\r\n"), records{{"a"}, {"b\r\n"}});
+        // Not enclosed in quotes as a whole.
+        CHECK_EQ(parse_values(R"("a"b,c)"), records{{R"("a"b)", "c"}});
+        // Unterminated quotes run to the end.
+        CHECK_EQ(parse_values("\"a,b\nc"), records{{"\"a,b\nc"}});
+    }
+
+    SUBCASE("fields are views unless escaped") {
+        const std::string_view text = R"(x,"y","z""")";
+        std::vector<strings::detail::csv_field> fields;
+        CHECK(strings::for_each_csv_field(text, [&fields](const auto& field, bool) {
+            fields.push_back(field);
+            return true;
+        }));
+        REQUIRE_EQ(fields.size(), 3);
+        CHECK_EQ(fields[0].raw, "x");
+        CHECK_EQ(fields[1].raw, "y");
+        CHECK_EQ(fields[1].raw.data(), text.data() + 3);
+        CHECK_FALSE(fields[1].escaped);
+        CHECK_EQ(fields[2].raw, R"(z"")");
+        CHECK(fields[2].escaped);
+        CHECK_EQ(fields[2].value(), "z\"");
+    }
+
+    SUBCASE("record ends and stopping") {
+        std::vector<bool> ends;
+        CHECK_FALSE(strings::for_each_csv_field("a,b\nc\nd,e", [&ends](const auto&, bool end) {
+            ends.push_back(end);
+            return ends.size() < 4;
+        }));
+        CHECK_EQ(ends, std::vector<bool>{false, true, true, false});
+
+        std::size_t visited{0};
+        CHECK_FALSE(strings::for_each_csv_record("a\nb\nc", [&visited](const auto&) {
+            return ++visited < 2;
+        }));
+        CHECK_EQ(visited, 2);
+    }
+
+    SUBCASE("tsv") {
+        const strings::csv_dialect tsv{'\t', '"'};
+        CHECK_EQ(parse_values("a\t\"b\tc\"\t,d\nx", tsv), records{{"a", "b\tc", ",d"}, {"x"}});
+    }
+
+    SUBCASE("round trip across blocks") {
+        std::mt19937 rng(42);
+        constexpr std::string_view alphabet = "ab,\"\n\r";
+        std::uniform_int_distribution<std::size_t> pick(0, alphabet.size() - 1);
+        std::uniform_int_distribution<std::size_t> length(0, 12);
+        for (int round = 0; round < 200; ++round) {
+            records recs(length(rng));
+            for (auto& rec : recs) {
+                rec.resize(length(rng) / 3 + 1);
+                for (auto& value : rec) {
+                    for (auto n = length(rng); n > 0; --n) {
+                        value.push_back(alphabet[pick(rng)]);
+                    }
+                }
+            }
+            const auto text = encode(recs, round % 2 == 0 ? "\n" : "\r\n");
+            CHECK_EQ(parse_values(text), recs);
+        }
+    }
+}
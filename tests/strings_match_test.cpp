@@ -2,8 +2,14 @@
 // This file is subject to the terms of license that can be found
 // in the LICENSE file.
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "doctest/doctest.h"
 
@@ -135,6 +141,39 @@ TEST_CASE("compare string and ignore ascii cases") {
         }
     }
 
+    SUBCASE("long strings are compared in blocks") {
+        std::string s1;
+        for (int i = 0; i < 100; ++i) {
+            s1.push_back(static_cast<char>((i * 29 + 3) % 256));
+        }
+        std::string s2 = s1;
+        for (auto& ch : s2) {
+            ch = strings::detail::ascii_to_upper(ch);
+        }
+        CHECK_EQ(strings::detail::compare_n_ignore_ascii_case(s1, s2, s1.size()), 0);
+        CHECK_EQ(strings::detail::mismatch_ignore_ascii_case(s1.data(), s2.data(), s1.size()),
+                 s1.size());
+
+        // Bytes adjacent to letters must not be folded.
+        for (std::size_t i : {0U, 15U, 16U, 31U, 32U, 47U, 63U, 64U, 99U}) {
+            for (const auto& [c1, c2] : {std::pair{'@', '`'}, std::pair{'[', '{'},
+                                         std::pair{'Z', 'y'}, std::pair{'\x80', '\xa0'}}) {
+                auto t1 = s1;
+                auto t2 = s2;
+                t1[i] = c1;
+                t2[i] = c2;
+                CHECK_EQ(strings::detail::mismatch_ignore_ascii_case(t1.data(), t2.data(),
+                                                                     t1.size()),
+                         i);
+                CHECK_EQ(strings::detail::compare_n_ignore_ascii_case(t1, t2, t1.size()),
+                         strings::detail::compare_n_ignore_ascii_case_scalar(t1, t2, t1.size()));
+                CHECK_EQ(strings::detail::compare_n_ignore_ascii_case(t2, t1, t1.size()),
+                         strings::detail::compare_n_ignore_ascii_case_scalar(t2, t1, t1.size()));
+                CHECK_FALSE(strings::equals_ignore_ascii_case(t1, t2));
+            }
+        }
+    }
+
     SUBCASE("check if two strings equal") {
         CHECK(strings::equals_ignore_ascii_case("foobar", "foobar"));
         CHECK(strings::equals_ignore_ascii_case("foobar", "FOOBAR"));
@@ -286,6 +325,257 @@ TEST_CASE("ends with ignore ascii case") {
     }
 }
 
+TEST_CASE("find ignore ascii case") {
+    SUBCASE("normal cases") {
+        CHECK_EQ(strings::find_ignore_ascii_case("Content-Type: text/html", "content-type"), 0);
+        CHECK_EQ(strings::find_ignore_ascii_case("Content-Type: text/html", "TEXT"), 14);
+        CHECK_EQ(strings::find_ignore_ascii_case("Content-Type: text/html", "L"), 22);
+        CHECK_EQ(strings::find_ignore_ascii_case("Content-Type: text/html", "xml"),
+                 std::string_view::npos);
+        CHECK_EQ(strings::find_ignore_ascii_case("abcABCabc", "ABC", 1), 3);
+        CHECK_EQ(strings::find_ignore_ascii_case("abc", "abcd"), std::string_view::npos);
+    }
+
+    SUBCASE("empty needle behaves like std::string_view::find") {
+        CHECK_EQ(strings::find_ignore_ascii_case("abc", ""), 0);
+        CHECK_EQ(strings::find_ignore_ascii_case("abc", "", 3), 3);
+        CHECK_EQ(strings::find_ignore_ascii_case("abc", "", 4), std::string_view::npos);
+    }
+
+    SUBCASE("only ascii letters are folded") {
+        CHECK_EQ(strings::find_ignore_ascii_case("a@b", "`"), std::string_view::npos);
+        CHECK_EQ(strings::find_ignore_ascii_case("[x]", "{X}"), std::string_view::npos);
+        CHECK_EQ(strings::find_ignore_ascii_case("\xc0\xe0", "\xe0"), 1);
+    }
+
+    SUBCASE("agree with searching on lowered text") {
+        std::string text;
+        for (int i = 0; i < 500; ++i) {
+            text.push_back("aAbB-"[(i * 7 + i / 3) % 5]);
+        }
+        std::string lowered = text;
+        for (auto& ch : lowered) {
+            ch = strings::detail::ascii_to_lower(ch);
+        }
+
+        for (const std::string_view needle : {"a", "Ab", "BBA", "ab-b", "b-aabb-", "--"}) {
+            std::string lowered_needle(needle);
+            for (auto& ch : lowered_needle) {
+                ch = strings::detail::ascii_to_lower(ch);
+            }
+            const strings::ignore_ascii_case_needle prepared{std::string(needle)};
+            for (std::size_t pos = 0; pos <= text.size(); pos += 13) {
+                const auto expected = lowered.find(lowered_needle, pos);
+                CHECK_EQ(strings::find_ignore_ascii_case(text, needle, pos), expected);
+                CHECK_EQ(strings::find_ignore_ascii_case(text, prepared, pos), expected);
+            }
+        }
+    }
+
+    SUBCASE("contains") {
+        CHECK(strings::contains_ignore_ascii_case("Transfer-Encoding: Chunked", "CHUNKED"));
+        CHECK_FALSE(strings::contains_ignore_ascii_case("Transfer-Encoding: gzip", "chunked"));
+
+        const strings::ignore_ascii_case_needle needle("keep-alive");
+        CHECK(needle.contains("Connection: Keep-Alive"));
+        CHECK(strings::contains_ignore_ascii_case("CONNECTION: KEEP-ALIVE", needle));
+        CHECK_FALSE(needle.contains("Connection: close"));
+        CHECK_EQ(needle.value(), "keep-alive");
+    }
+}
+
+TEST_CASE("ascii case-insensitive hash and equal") {
+    SUBCASE("fold a word of 8 bytes") {
+        for (int i = 0; i < k_table_size; i += 8) {
+            std::uint64_t word{0};
+            std::uint64_t expected{0};
+            for (int j = 0; j < 8; ++j) {
+                const auto c = static_cast<std::uint64_t>(i + j);
+                word |= c << (j * 8);
+                expected |= static_cast<std::uint64_t>(
+                                    static_cast<unsigned char>(to_lower_table[i + j]))
+                            << (j * 8);
+            }
+            CHECK_EQ(strings::detail::ascii_to_lower_word(word), expected);
+        }
+    }
+
+    SUBCASE("hash ignores ascii case") {
+        const strings::ascii_case_insensitive_hash hash;
+        CHECK_EQ(hash("Content-Type"), hash("content-type"));
+        CHECK_EQ(hash("CONTENT-TYPE"), hash("content-type"));
+        CHECK_EQ(hash("X-Forwarded-For-Some-Long-Header"),
+                 hash("x-forwarded-for-some-long-header"));
+        CHECK_EQ(hash(""), hash(std::string{}));
+        CHECK_NE(hash("Content-Type"), hash("Content-Length"));
+        CHECK_NE(hash("a"), hash(std::string_view{"a\0", 2}));
+        CHECK_NE(hash("@"), hash("`"));
+    }
+
+    SUBCASE("equal ignores ascii case") {
+        const strings::ascii_case_insensitive_equal eq;
+        CHECK(eq("Content-Type", "content-type"));
+        CHECK_FALSE(eq("Content-Type", "content-typ"));
+    }
+
+    SUBCASE("as functors of unordered containers") {
+        std::unordered_map<std::string, int, strings::ascii_case_insensitive_hash,
+                           strings::ascii_case_insensitive_equal>
+                headers{{"Content-Type", 1}, {"Content-Length", 2}};
+        CHECK_EQ(headers.count("content-type"), 1);
+        CHECK_EQ(headers.at("CONTENT-LENGTH"), 2);
+        CHECK_EQ(headers.count("host"), 0);
+        headers.emplace("HOST", 3);
+        CHECK_EQ(headers.at("Host"), 3);
+
+#if defined(__cpp_lib_generic_unordered_lookup)
+        CHECK_EQ(headers.find(std::string_view{"content-type"})->second, 1);
+#endif
+    }
+}
+
+TEST_CASE("prefix set") {
+    SUBCASE("longest and shortest prefixes") {
+        const strings::prefix_set routes{"/api", "/api/v1", "/api/v1/users", "/static", "/"};
+        REQUIRE_EQ(routes.size(), 5);
+        CHECK_EQ(routes.find_longest("/api/v1/users/42"), 2);
+        CHECK_EQ(routes.find_longest("/api/v2"), 0);
+        CHECK_EQ(routes.find_longest("/static/a.css"), 3);
+        CHECK_EQ(routes.find_longest("/index.html"), 4);
+        CHECK_EQ(routes.find_longest("api"), strings::prefix_set::npos);
+        CHECK_EQ(routes.find_shortest("/api/v1/users/42"), 4);
+        CHECK_EQ(routes[routes.find_longest("/api/v1/")], "/api/v1");
+        CHECK(routes.matches("/"));
+        CHECK_FALSE(routes.matches(""));
+        CHECK_FALSE(routes.matches("api"));
+    }
+
+    SUBCASE("empty and duplicated prefixes") {
+        const strings::prefix_set prefixes{"ab", "", "ab"};
+        CHECK_EQ(prefixes.find_longest("abc"), 0);
+        CHECK_EQ(prefixes.find_longest("xyz"), 1);
+        CHECK_EQ(prefixes.find_shortest(""), 1);
+
+        const strings::prefix_set none(std::vector<std::string>{});
+        CHECK_EQ(none.size(), 0);
+        CHECK_FALSE(none.matches("anything"));
+    }
+
+    SUBCASE("ignore ascii case") {
+        const strings::prefix_set prefixes({"Content-", "X-Forwarded-"}, true);
+        CHECK(prefixes.ignores_ascii_case());
+        CHECK_EQ(prefixes.find_longest("content-type"), 0);
+        CHECK_EQ(prefixes.find_longest("x-FORWARDED-for"), 1);
+        CHECK_FALSE(prefixes.matches("Contentment"));
+
+        const strings::prefix_set exact{"Content-"};
+        CHECK_FALSE(exact.matches("content-type"));
+    }
+
+    SUBCASE("very long prefixes") {
+        const std::string long_key(std::size_t{1} << 20, 'a');
+        const strings::prefix_set prefixes{long_key, "aa"};
+        CHECK_EQ(prefixes.find_longest(long_key + "b"), 0);
+        CHECK_EQ(prefixes.find_longest(long_key.substr(1)), 1);
+        CHECK_EQ(prefixes.find_shortest(long_key), 1);
+    }
+
+    SUBCASE("agree with linear starts_with on many prefixes") {
+        // Every byte value shows up as a label, to exercise both linear and binary edge search.
+        std::vector<std::string> prefixes;
+        for (int i = 0; i < 256; ++i) {
+            const auto ch = static_cast<char>(i);
+            prefixes.emplace_back(1, ch);
+            prefixes.push_back(std::string(2, ch) + "/" + std::to_string(i));
+        }
+        const strings::prefix_set set(prefixes);
+
+        for (int i = 0; i < 256; i += 3) {
+            const auto ch = static_cast<char>(i);
+            const auto key = std::string(2, ch) + "/";
+            for (const auto& str : {std::string(1, ch), key, key + std::to_string(i) + "/x"}) {
+                std::size_t expected = strings::prefix_set::npos;
+                for (std::size_t idx = 0; idx < prefixes.size(); ++idx) {
+                    if (strings::starts_with(str, prefixes[idx]) &&
+                        (expected == strings::prefix_set::npos ||
+                         prefixes[idx].size() > prefixes[expected].size())) {
+                        expected = idx;
+                    }
+                }
+                CHECK_EQ(set.find_longest(str), expected);
+            }
+        }
+    }
+}
+
+TEST_CASE("match compile-time literals") {
+    SUBCASE("literal types") {
+        constexpr auto get = ESL_STRING_LITERAL("GET ");
+        using get_t = std::decay_t<decltype(get)>;
+        static_assert(std::is_same_v<get_t, strings::literal<'G', 'E', 'T', ' '>>);
+        static_assert(get_t::size() == 4);
+        CHECK_EQ(get_t::view(), "GET ");
+        const auto embedded_nul = ESL_STRING_LITERAL("a\0b");
+        CHECK_EQ(embedded_nul.view(), std::string_view("a\0b", 3));
+    }
+
+    SUBCASE("agree with runtime versions on every length") {
+        const std::string text = "Content-Type: Application/JSON; Charset=UTF-8";
+        const auto lit = ESL_STRING_LITERAL("content-type: application/json; charset=utf-8");
+        const auto exact = ESL_STRING_LITERAL("Content-Type: Application/JSON; Charset=UTF-8");
+        const auto suffix_lit = ESL_STRING_LITERAL("; charset=utf-8");
+        for (std::size_t len = 0; len <= text.size(); ++len) {
+            const auto str = std::string_view{text}.substr(0, len);
+            CHECK_EQ(strings::starts_with(str, exact), strings::starts_with(str, exact.view()));
+            CHECK_EQ(strings::ends_with(text.substr(len), suffix_lit),
+                     strings::ends_with(text.substr(len), suffix_lit.view()));
+            CHECK_EQ(strings::equals_ignore_ascii_case(str, lit),
+                     strings::equals_ignore_ascii_case(str, lit.view()));
+            CHECK_EQ(strings::ends_with_ignore_ascii_case(str, suffix_lit),
+                     strings::ends_with_ignore_ascii_case(str, suffix_lit.view()));
+        }
+    }
+
+    SUBCASE("fixed lengths") {
+        CHECK(strings::starts_with("", ESL_STRING_LITERAL("")));
+        CHECK(strings::starts_with("G", ESL_STRING_LITERAL("G")));
+        CHECK_FALSE(strings::starts_with("g", ESL_STRING_LITERAL("G")));
+        CHECK(strings::starts_with("GET /", ESL_STRING_LITERAL("GET")));
+        CHECK_FALSE(strings::starts_with("GE", ESL_STRING_LITERAL("GET")));
+        CHECK(strings::starts_with("POST /", ESL_STRING_LITERAL("POST ")));
+        CHECK_FALSE(strings::starts_with("POSTS", ESL_STRING_LITERAL("POST ")));
+        CHECK(strings::ends_with("index.html", ESL_STRING_LITERAL(".html")));
+        CHECK_FALSE(strings::ends_with("index.htm", ESL_STRING_LITERAL(".html")));
+        CHECK(strings::starts_with("Transfer-Encoding: chunked",
+                                   ESL_STRING_LITERAL("Transfer-Encoding:")));
+        CHECK_FALSE(strings::starts_with("Transfer-Encodinf: chunked",
+                                         ESL_STRING_LITERAL("Transfer-Encoding:")));
+    }
+
+    SUBCASE("ignore case only for letters") {
+        CHECK(strings::starts_with_ignore_ascii_case("get /", ESL_STRING_LITERAL("GET ")));
+        CHECK(strings::equals_ignore_ascii_case("CHUNKED", ESL_STRING_LITERAL("chunked")));
+        // '@' is '`' with 0x20 cleared, and must not match.
+        CHECK_FALSE(strings::equals_ignore_ascii_case("@", ESL_STRING_LITERAL("`")));
+        CHECK_FALSE(strings::equals_ignore_ascii_case("`", ESL_STRING_LITERAL("@")));
+        CHECK_FALSE(strings::starts_with_ignore_ascii_case("[x", ESL_STRING_LITERAL("{x")));
+        const auto alive = ESL_STRING_LITERAL("-ALIVE");
+        CHECK(strings::ends_with_ignore_ascii_case("keep-alivE", alive));
+        CHECK_FALSE(strings::ends_with_ignore_ascii_case("keep-alivF", alive));
+    }
+
+    SUBCASE("exhaustive single byte") {
+        for (int i = 0; i < k_table_size; ++i) {
+            const auto ch = static_cast<char>(i);
+            const std::string_view str(&ch, 1);
+            CHECK_EQ(strings::equals_ignore_ascii_case(str, ESL_STRING_LITERAL("q")),
+                     strings::equals_ignore_ascii_case(str, "q"));
+            CHECK_EQ(strings::equals_ignore_ascii_case(str, ESL_STRING_LITERAL("[")),
+                     strings::equals_ignore_ascii_case(str, "["));
+        }
+    }
+}
+
 TEST_SUITE_END();
 
 } // namespace
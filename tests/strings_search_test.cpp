@@ -0,0 +1,214 @@
+// Copyright (c) 2026 Kingsley Chen <kingsamchen at gmail dot com>
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "doctest/doctest.h"
+
+#include "esl/detail/strings_search.h"
+#include "esl/strings.h"
+
+#include "tests/stringification.h"
+
+namespace detail = esl::strings::detail;
+namespace strings = esl::strings;
+
+namespace {
+
+std::vector<std::size_t> find_all_non_overlapping(std::string_view text, std::string_view pattern) {
+    std::vector<std::size_t> positions;
+    for (auto pos = text.find(pattern); pos != std::string_view::npos;
+         pos = text.find(pattern, pos + pattern.size())) {
+        positions.push_back(pos);
+    }
+    return positions;
+}
+
+// Generates a text with a small alphabet, to have plenty of partial matches.
+std::string make_text(std::size_t len) {
+    std::string text;
+    unsigned seed = 7;
+    for (std::size_t i = 0; i < len; ++i) {
+        seed = seed * 1103515245 + 12345;
+        text.push_back("ab\r\n|"[(seed >> 16) % 5]);
+    }
+    return text;
+}
+
+using match_list = std::vector<strings::multi_pattern_searcher::match>;
+
+// Finds all occurrences, overlapped ones included, in the order `multi_pattern_searcher` reports.
+match_list find_all_naive(std::string_view text, const std::vector<std::string>& patterns) {
+    match_list matches;
+    for (std::size_t end = 1; end <= text.size(); ++end) {
+        std::vector<std::size_t> ending;
+        for (std::size_t idx = 0; idx < patterns.size(); ++idx) {
+            const auto& p = patterns[idx];
+            const auto prior = patterns.begin() + static_cast<std::ptrdiff_t>(idx);
+            const bool dup = std::find(patterns.begin(), prior, p) != prior;
+            if (!dup && p.size() <= end && text.substr(end - p.size(), p.size()) == p) {
+                ending.push_back(idx);
+            }
+        }
+        std::sort(ending.begin(), ending.end(), [&patterns](std::size_t lhs, std::size_t rhs) {
+            return patterns[lhs].size() > patterns[rhs].size();
+        });
+        for (const auto idx : ending) {
+            matches.push_back({idx, end - patterns[idx].size()});
+        }
+    }
+    return matches;
+}
+
+TEST_SUITE_BEGIN("strings/search");
+
+TEST_CASE("substring searcher") {
+    const auto text = make_text(1000);
+    const std::string patterns[] = {
+            "a",
+            "\n",
+            "||",
+            "\r\n",
+            "\r\n\r\n",
+            "ab|",
+            text.substr(100, 31),
+            text.substr(200, 32),
+            text.substr(300, 100),
+            "not-present",
+            std::string(40, 'z'),
+    };
+
+    SUBCASE("find agrees with std::string_view::find") {
+        for (const auto& pattern : patterns) {
+            const detail::substring_searcher searcher(pattern);
+            for (std::size_t pos = 0; pos <= text.size() + 1; ++pos) {
+                CHECK_EQ(searcher.find(text, pos), std::string_view{text}.find(pattern, pos));
+            }
+        }
+    }
+
+    SUBCASE("visit non-overlapping occurrences") {
+        for (const auto& pattern : patterns) {
+            const detail::substring_searcher searcher(pattern);
+            std::vector<std::size_t> positions;
+            CHECK(searcher.for_each(text, 0, [&positions](std::size_t pos) {
+                positions.push_back(pos);
+                return true;
+            }));
+            CHECK_EQ(positions, find_all_non_overlapping(text, pattern));
+        }
+    }
+
+    SUBCASE("overlapped occurrences") {
+        const std::string_view pipes = "|||||";
+        const detail::substring_searcher searcher("||");
+        std::vector<std::size_t> positions;
+        searcher.for_each(pipes, 0, [&positions](std::size_t pos) {
+            positions.push_back(pos);
+            return true;
+        });
+        CHECK_EQ(positions, std::vector<std::size_t>{0, 2});
+    }
+
+    SUBCASE("text shorter than pattern") {
+        const detail::substring_searcher searcher("\r\n\r\n");
+        CHECK_EQ(searcher.find("\r\n\r", 0), std::string_view::npos);
+        CHECK_EQ(searcher.find("", 0), std::string_view::npos);
+    }
+
+    SUBCASE("copies remain usable") {
+        auto searcher = std::make_unique<detail::substring_searcher>(std::string(40, 'x'));
+        const auto copied = *searcher;
+        searcher.reset();
+        const auto haystack = "ab" + std::string(41, 'x');
+        CHECK_EQ(copied.find(haystack, 0), 2);
+        CHECK_EQ(copied.pattern(), std::string(40, 'x'));
+    }
+}
+
+TEST_CASE("multi-pattern searcher") {
+    const auto text = make_text(600);
+    const std::vector<std::string> patterns{
+            "a", "ab", "b|", "\r\n", "\r\n\r\n", "|\r\na", "ab", text.substr(50, 20), "zzz"};
+    const strings::multi_pattern_searcher searcher(patterns);
+    REQUIRE_EQ(searcher.size(), patterns.size());
+
+    SUBCASE("find all agrees with naive search") {
+        CHECK(searcher.find_all(text) == find_all_naive(text, patterns));
+        CHECK(searcher.find_all("").empty());
+        CHECK(searcher.find_all("zz").empty());
+    }
+
+    SUBCASE("overlapped and nested occurrences") {
+        const strings::multi_pattern_searcher s{"he", "she", "his", "hers"};
+        const match_list expected{{1, 1}, {0, 2}, {3, 2}};
+        CHECK(s.find_all("ushers") == expected);
+        CHECK_EQ(s[s.find_all("ushers").back().pattern], "hers");
+    }
+
+    SUBCASE("first match") {
+        const strings::multi_pattern_searcher s{"error", "warn", "fatal"};
+        const auto found = s.find_first("[info] ok; [warn] disk; [error] io");
+        REQUIRE(found.has_value());
+        CHECK_EQ(found->pattern, 1);
+        CHECK_EQ(found->pos, 12);
+        CHECK_FALSE(s.find_first("all good").has_value());
+        CHECK(s.contains_any("FATAL fatal"));
+    }
+
+    SUBCASE("stop early") {
+        std::size_t visited = 0;
+        CHECK_FALSE(searcher.for_each(text, [&visited](std::size_t, std::size_t) {
+            return ++visited < 3;
+        }));
+        CHECK_EQ(visited, 3);
+    }
+
+    SUBCASE("ignore ascii case") {
+        const strings::multi_pattern_searcher s({"Error", "TIMEOUT"}, true);
+        const match_list expected{{0, 0}, {1, 10}, {0, 19}};
+        CHECK(s.find_all("ERROR: io timeout; error") == expected);
+    }
+
+    SUBCASE("patterns over all byte values") {
+        std::vector<std::string> bytes;
+        std::string all;
+        for (int i = 0; i < 256; ++i) {
+            bytes.emplace_back(1, static_cast<char>(i));
+            all.push_back(static_cast<char>(i));
+        }
+        bytes.push_back(all.substr(250));
+        const strings::multi_pattern_searcher s(bytes);
+        CHECK(s.find_all(all) == find_all_naive(all, bytes));
+    }
+
+    SUBCASE("stream across chunk boundaries") {
+        const auto expected = find_all_naive(text, patterns);
+        for (std::size_t chunk_size = 1; chunk_size <= 70; chunk_size += 3) {
+            auto stream = searcher.make_stream();
+            match_list matches;
+            for (std::size_t pos = 0; pos < text.size(); pos += chunk_size) {
+                const auto chunk = std::string_view{text}.substr(pos, chunk_size);
+                const auto found = stream.feed(chunk);
+                matches.insert(matches.end(), found.begin(), found.end());
+            }
+            CHECK_EQ(stream.consumed(), text.size());
+            CHECK(matches == expected);
+        }
+
+        auto stream = searcher.make_stream();
+        stream.feed("\r\n\r");
+        stream.reset();
+        CHECK(stream.feed("\n").empty());
+    }
+}
+
+TEST_SUITE_END();
+
+} // namespace
@@ -2,6 +2,7 @@
 // This file is subject to the terms of license that can be found
 // in the LICENSE file.
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <deque>
@@ -12,6 +13,7 @@
 #include <map>
 #include <queue>
 #include <set>
+#include <stdexcept>
 #include <stack>
 #include <string>
 #include <string_view>
@@ -24,6 +26,8 @@
 #include "doctest/doctest.h"
 
 #include "esl/detail/strings_split.h"
+#include "esl/flat_string_vector.h"
+#include "esl/small_vector.h"
 #include "esl/ignore_unused.h"
 #include "esl/strings.h"
 
@@ -63,20 +67,43 @@ TEST_SUITE_BEGIN("strings/split");
 
 TEST_CASE("split iterator") {
     SUBCASE("type traits") {
-        using iter_t = detail::split_iterator<dummy_delimiter, allow_any_t>;
+        using iter_t = detail::split_iterator<
+                detail::split_view<std::string_view, dummy_delimiter, allow_any_t>>;
         static_assert(std::is_same_v<std::iterator_traits<iter_t>::iterator_category,
                                      std::forward_iterator_tag>);
     }
 
+    SUBCASE("cheap to copy") {
+        // Iterators refer to the view instead of owning copies of its parts.
+        using view_t = detail::split_view<std::string_view, strings::by_string, not_empty_t>;
+        using iter_t = view_t::const_iterator;
+        static_assert(std::is_trivially_copyable_v<iter_t>);
+        static_assert(std::is_trivially_copyable_v<detail::split_iterator<
+                              detail::split_view<std::string, strings::by_any_char, allow_any_t>>>);
+        static_assert(!std::is_constructible_v<iter_t, view_t, std::size_t>);
+        // A pointer to the view, the current field and the position.
+        static_assert(sizeof(iter_t) <= sizeof(void*) * 5);
+        static_assert(sizeof(decltype(strings::split("", ',').begin())) <= sizeof(void*) * 5);
+
+        const view_t view("a::b::::c", strings::by_string("::"), not_empty);
+        auto it = view.begin();
+        const auto copied = it++;
+        CHECK_EQ(*copied, "a");
+        CHECK_EQ(*it, "b");
+        CHECK_EQ(*++it, "c");
+    }
+
     SUBCASE("compare against end iterator") {
-        using iter_t = detail::split_iterator<strings::by_string, allow_any_t>;
+        using view_t = detail::split_view<std::string_view, strings::by_string, allow_any_t>;
+        using iter_t = view_t::const_iterator;
 
         const iter_t end1;
         const iter_t end2;
         CHECK_EQ(end1, end2);
 
-        const iter_t iter("abc\ndef", 0, strings::by_string("\n"), allow_any);
-        const iter_t it_end("abc\ndef");
+        const view_t view("abc\ndef", strings::by_string("\n"), allow_any);
+        const auto iter = view.begin();
+        const auto it_end = view.end();
         CHECK_NE(iter, end1);
         CHECK_NE(iter, it_end);
         CHECK_EQ(it_end, end1);
@@ -84,8 +111,10 @@ TEST_CASE("split iterator") {
     }
 
     SUBCASE("compare iterators") {
-        using iter_t = detail::split_iterator<strings::by_string, allow_any_t>;
-        iter_t it("abc\ndef\n", 0, strings::by_string("\n"), allow_any);
+        using view_t = detail::split_view<std::string_view, strings::by_string, allow_any_t>;
+        using iter_t = view_t::const_iterator;
+        const view_t view("abc\ndef\n", strings::by_string("\n"), allow_any);
+        auto it = view.begin();
         CHECK_EQ(*it, "abc");
         ++it;
         CHECK_EQ(*it, "def");
@@ -96,13 +125,15 @@ TEST_CASE("split iterator") {
     }
 
     SUBCASE("iterate by string delimiter and allow any token") {
-        using iter_t = detail::split_iterator<strings::by_string, allow_any_t>;
+        using view_t = detail::split_view<std::string_view, strings::by_string, allow_any_t>;
+        using iter_t = view_t::const_iterator;
         const strings::by_string delim("\r\n");
         std::vector<std::string_view> tokens;
 
         SUBCASE("normal case") {
             const std::string str{"abc\r\ndef\r\nfoobar"};
-            for (iter_t it(str, 0, delim, allow_any); it != iter_t{}; ++it) {
+            const view_t view(str, delim, allow_any);
+            for (auto it = view.begin(); it != iter_t{}; ++it) {
                 tokens.push_back(*it);
             }
             REQUIRE_EQ(tokens.size(), 3);
@@ -110,9 +141,8 @@ TEST_CASE("split iterator") {
         }
 
         SUBCASE("empty input") {
-            const std::string_view sv{};
-
-            for (iter_t it(sv, 0, delim, allow_any); it != iter_t{}; ++it) {
+            const view_t view(std::string_view{}, delim, allow_any);
+            for (auto it = view.begin(); it != iter_t{}; ++it) {
                 tokens.push_back(*it);
             }
             REQUIRE_EQ(tokens.size(), 1);
@@ -120,8 +150,8 @@ TEST_CASE("split iterator") {
         }
 
         SUBCASE("input doesn't contain delim") {
-            const std::string_view sv = "foobar";
-            for (iter_t it(sv, 0, delim, allow_any); it != iter_t{}; ++it) {
+            const view_t view("foobar", delim, allow_any);
+            for (auto it = view.begin(); it != iter_t{}; ++it) {
                 tokens.push_back(*it);
             }
             REQUIRE_EQ(tokens.size(), 1);
@@ -129,8 +159,8 @@ TEST_CASE("split iterator") {
         }
 
         SUBCASE("input contains only delim") {
-            const std::string_view sv = "\r\n";
-            for (iter_t it(sv, 0, delim, allow_any); it != iter_t{}; ++it) {
+            const view_t view("\r\n", delim, allow_any);
+            for (auto it = view.begin(); it != iter_t{}; ++it) {
                 tokens.push_back(*it);
             }
             REQUIRE_EQ(tokens.size(), 2);
@@ -139,7 +169,8 @@ TEST_CASE("split iterator") {
 
         SUBCASE("multipass support") {
             const std::string str{"abc\r\ndef\r\nfoobar"};
-            const iter_t it(str, 0, delim, allow_any);
+            const view_t view(str, delim, allow_any);
+            const auto it = view.begin();
             // `it` is copied as the parameter.
             auto distance = std::distance(it, iter_t{});
             CHECK_EQ(distance, 3);
@@ -152,10 +183,12 @@ TEST_CASE("split iterator") {
     }
 
     SUBCASE("use predicate to filter tokens") {
-        using iter_t = detail::split_iterator<strings::by_string, not_empty_t>;
+        using view_t = detail::split_view<std::string_view, strings::by_string, not_empty_t>;
+        using iter_t = view_t::const_iterator;
         const std::string str{"abc\r\n\r\ndef\r\n\r\n"};
         std::vector<std::string_view> tokens;
-        iter_t it(str, 0, strings::by_string("\r\n"), not_empty);
+        const view_t view(str, strings::by_string("\r\n"), not_empty);
+        auto it = view.begin();
         size_t incr_count = 0;
         for (; it != iter_t{}; ++it, ++incr_count) {
             tokens.push_back(*it);
@@ -165,10 +198,12 @@ TEST_CASE("split iterator") {
     }
 
     SUBCASE("split by any character") {
-        using iter_t = detail::split_iterator<strings::by_any_char, not_empty_t>;
+        using view_t = detail::split_view<std::string_view, strings::by_any_char, not_empty_t>;
+        using iter_t = view_t::const_iterator;
         const std::string str{"abc\r\n\r\ndef\n\r\n\r"};
         std::vector<std::string_view> tokens;
-        iter_t it(str, 0, strings::by_any_char("\r\n"), not_empty);
+        const view_t view(str, strings::by_any_char("\r\n"), not_empty);
+        auto it = view.begin();
         size_t incr_count = 0;
         for (; it != iter_t{}; ++it, ++incr_count) {
             tokens.push_back(*it);
@@ -219,6 +254,91 @@ TEST_CASE("split view to container usages") {
     CHECK_EQ(vec_str, std::vector<std::string>{"foo", "bar", "baz", "hello", "world"});
 }
 
+TEST_CASE("split view to vector of string_view in one pass") {
+    std::string text;
+    for (int i = 0; i < 100; ++i) {
+        text.append(static_cast<std::size_t>(i % 7), 'x').append(1, ',');
+    }
+
+    SUBCASE("allow any") {
+        auto sv = strings::split(text, ',');
+        std::vector<std::string_view> expected(sv.begin(), sv.end());
+        CHECK_EQ(sv.to<std::vector<std::string_view>>(), expected);
+        CHECK_EQ(expected.size(), 101);
+        CHECK(expected.back().empty());
+    }
+
+    SUBCASE("skip empty") {
+        auto sv = strings::split(text, ',', strings::skip_empty{});
+        std::vector<std::string_view> expected(sv.begin(), sv.end());
+        CHECK_EQ(sv.to<std::vector<std::string_view>>(), expected);
+        CHECK_EQ(expected.size(), 85);
+    }
+
+    SUBCASE("empty text") {
+        auto vec = strings::split("", ',').to<std::vector<std::string_view>>();
+        CHECK_EQ(vec, std::vector<std::string_view>{""});
+    }
+}
+
+TEST_CASE("split index") {
+    SUBCASE("random access to fields") {
+        const std::string_view line = "2026-10-16,GET,/api/v1/users,200,1532,0.004";
+        const auto view = strings::split(line, ',');
+        const auto index = view.index();
+        REQUIRE_EQ(index.size(), 6);
+        CHECK_EQ(index[2], "/api/v1/users");
+        CHECK_EQ(index[5], "0.004");
+        CHECK_EQ(index.at(0), "2026-10-16");
+        CHECK_THROWS_AS(esl::ignore_unused(index.at(6)), std::out_of_range);
+        CHECK_EQ(index.text().data(), line.data());
+
+        const std::vector<std::string_view> fields(index.begin(), index.end());
+        CHECK_EQ(fields, view.to<std::vector<std::string_view>>());
+    }
+
+    SUBCASE("random access iterators") {
+        using iter_t = decltype(strings::split("", ',').index().begin());
+        static_assert(std::is_same_v<std::iterator_traits<iter_t>::iterator_category,
+                                     std::random_access_iterator_tag>);
+
+        const auto index = strings::split("a b c d e", ' ').index();
+        auto it = index.begin();
+        CHECK_EQ(index.end() - it, 5);
+        CHECK_EQ(it[3], "d");
+        CHECK_EQ(*(it + 4), "e");
+        it += 2;
+        CHECK_EQ(*it--, "c");
+        CHECK_EQ(*it, "b");
+        CHECK(index.begin() < it);
+        CHECK_EQ(*std::prev(index.end()), "e");
+    }
+
+    SUBCASE("agree with split view on delimiters and predicates") {
+        const std::string text = "::a:b::cd:::e:";
+        auto check = [](const auto& view) {
+            const auto index = view.index();
+            const auto expected = view.template to<std::vector<std::string_view>>();
+            REQUIRE_EQ(index.size(), expected.size());
+            CHECK_EQ(std::vector<std::string_view>(index.begin(), index.end()), expected);
+        };
+        check(strings::split(text, ':'));
+        check(strings::split(text, ':', strings::skip_empty{}));
+        check(strings::split(text, "::"));
+        check(strings::split(text, strings::by_any_char("a:")));
+        check(strings::split(text, strings::by_length(3)));
+        check(strings::split("", ':'));
+        check(strings::split("", ':', strings::skip_empty{}));
+    }
+
+    SUBCASE("owned text outlives the view") {
+        const auto index = strings::split(std::string("x|yy|zzz"), '|').index();
+        REQUIRE_EQ(index.size(), 3);
+        CHECK_EQ(index[1], "yy");
+        CHECK_EQ(index[2], "zzz");
+    }
+}
+
 TEST_CASE_TEMPLATE("split view with StringTypes", StringType, std::string_view, std::string) {
     using split_view = detail::split_view<StringType, strings::by_any_char, strings::skip_empty>;
     const split_view splitter("-foo--bar--baz--hello--world-", strings::by_any_char{"-"}, {});
@@ -318,6 +438,55 @@ TEST_CASE("delimiter by_char") {
         CHECK_EQ(bc.find(text, 0), text.find('\n'));
         CHECK_EQ(bc.find(text, text.find('\n') + 1), std::string::npos);
     }
+
+    SUBCASE("find across blocks") {
+        std::string text(200, 'a');
+        for (const std::size_t i : {0U, 15U, 16U, 63U, 64U, 65U, 127U, 128U, 190U, 199U}) {
+            text[i] = ',';
+        }
+        const strings::by_char bc(',');
+        for (std::size_t pos = 0; pos <= text.size() + 1; ++pos) {
+            CHECK_EQ(bc.find(text, pos), text.find(',', pos));
+        }
+    }
+
+    SUBCASE("visit every delimiter in one pass") {
+        std::string text(150, 'a');
+        const std::vector<std::size_t> expected{3, 31, 32, 64, 100, 149};
+        for (auto i : expected) {
+            text[i] = '\n';
+        }
+        const strings::by_char bc('\n');
+        std::vector<std::size_t> positions;
+        CHECK(bc.for_each(text, 0, [&positions](std::size_t pos) {
+            positions.push_back(pos);
+            return true;
+        }));
+        CHECK_EQ(positions, expected);
+
+        positions.clear();
+        CHECK(bc.for_each(text, 33, [&positions](std::size_t pos) {
+            positions.push_back(pos);
+            return true;
+        }));
+        CHECK_EQ(positions, std::vector<std::size_t>{64, 100, 149});
+    }
+
+    SUBCASE("stop visiting once callback returns false") {
+        const std::string text = "a,b,c,d";
+        const strings::by_char bc(',');
+        std::vector<std::size_t> positions;
+        CHECK_FALSE(bc.for_each(text, 0, [&positions](std::size_t pos) {
+            positions.push_back(pos);
+            return positions.size() < 2;
+        }));
+        CHECK_EQ(positions, std::vector<std::size_t>{1, 3});
+    }
+
+    SUBCASE("support bulk scan") {
+        static_assert(detail::has_bulk_scan_v<strings::by_char>);
+        static_assert(!detail::has_bulk_scan_v<dummy_delimiter>);
+    }
 }
 
 TEST_CASE("delimiter by_any_char") {
@@ -351,6 +520,53 @@ TEST_CASE("delimiter by_any_char") {
         pos = bac.find(text, pos + 1);
         CHECK_EQ(pos, text.find('\t'));
     }
+
+    SUBCASE("duplicate delimiters are allowed") {
+        const strings::by_any_char bac(",,;,");
+        const std::string text = "a;b,c";
+        CHECK_EQ(bac.find(text, 0), 1);
+        CHECK_EQ(bac.find(text, 2), 3);
+    }
+
+    SUBCASE("agree with find_first_of on various sets") {
+        std::string text;
+        for (int i = 0; i < 600; ++i) {
+            text.push_back(static_cast<char>((i * 37 + 11) % 256));
+        }
+
+        using namespace std::string_literals;
+        const std::string sets[] = {
+                " \t\r\n,;",
+                "\x80\xff",
+                "\0"s,
+                // More than 8 distinct nibbles on both sides.
+                "\x01\x12\x23\x34\x45\x56\x67\x78\x89\x9a",
+                // More than 16 distinct bytes.
+                "abcdefghijklmnopqrstuvwxyz0123456789",
+        };
+        for (const auto& set : sets) {
+            const strings::by_any_char bac(set);
+            for (std::size_t pos = 0; pos <= text.size(); pos += 7) {
+                CHECK_EQ(bac.find(text, pos), text.find_first_of(set, pos));
+            }
+
+            std::vector<std::size_t> positions;
+            bac.for_each(text, 0, [&positions](std::size_t pos) {
+                positions.push_back(pos);
+                return true;
+            });
+            std::vector<std::size_t> expected;
+            for (auto pos = text.find_first_of(set); pos != std::string::npos;
+                 pos = text.find_first_of(set, pos + 1)) {
+                expected.push_back(pos);
+            }
+            CHECK_EQ(positions, expected);
+        }
+    }
+
+    SUBCASE("support bulk scan") {
+        static_assert(detail::has_bulk_scan_v<strings::by_any_char>);
+    }
 }
 
 TEST_CASE("delimiter by_length") {
@@ -385,6 +601,442 @@ TEST_CASE("delimiter by_length") {
     }
 }
 
+TEST_CASE("count fields") {
+    auto distance = [](const auto& view) {
+        return static_cast<std::size_t>(std::distance(view.begin(), view.end()));
+    };
+
+    std::string long_text;
+    for (int i = 0; i < 50; ++i) {
+        long_text.append(i % 3 == 0 ? "abc,;" : "de;");
+    }
+
+    SUBCASE("fast counting") {
+        for (const std::string_view text : {std::string_view{}, std::string_view{","},
+                                            std::string_view{"a,b,,c"},
+                                            std::string_view{long_text}}) {
+            CAPTURE(text);
+            CHECK_EQ(strings::split(text, ',').count(), distance(strings::split(text, ',')));
+            CHECK_EQ(strings::split(text, strings::by_any_char(",;")).count(),
+                     distance(strings::split(text, strings::by_any_char(",;"))));
+            CHECK_EQ(strings::rsplit(text, ';').count(), distance(strings::rsplit(text, ';')));
+            CHECK_EQ(strings::split(text, strings::max_splits(';', 3)).count(),
+                     distance(strings::split(text, strings::max_splits(';', 3))));
+        }
+        CHECK_EQ(strings::split(long_text, ';').count(), 51);
+        CHECK_EQ(strings::split(long_text, strings::max_splits(';', 0)).count(), 1);
+    }
+
+    SUBCASE("counting by producing fields") {
+        CHECK_EQ(strings::split(long_text, ';', strings::skip_empty{}).count(), 50);
+        CHECK_EQ(strings::split(long_text, ",;").count(), 18);
+        CHECK_EQ(strings::split("abcdefg", strings::by_length(2)).count(), 4);
+    }
+
+    SUBCASE("reserve exactly") {
+        const auto views = strings::split(long_text, ';').to<std::vector<std::string_view>>();
+        CHECK_EQ(views.size(), 51);
+        CHECK_EQ(views.capacity(), 51);
+
+        const auto strs = strings::split(long_text, ',').to<std::vector<std::string>>();
+        CHECK_EQ(strs.size(), 18);
+        CHECK_EQ(strs.capacity(), 18);
+        CHECK_EQ(strs[1], ";de;de;abc");
+
+        const auto reversed = strings::rsplit(long_text, ',').to<std::vector<std::string_view>>();
+        CHECK_EQ(reversed.capacity(), 18);
+        CHECK_EQ(reversed.front(), ";de;");
+    }
+}
+
+TEST_CASE("split into caller-provided storage") {
+    const std::string_view request_line = "GET /index.html HTTP/1.1";
+
+    SUBCASE("fixed arrays") {
+        std::string_view parts[4];
+        const auto result = strings::split(request_line, ' ').into(parts);
+        CHECK_EQ(result.count, 3);
+        CHECK_FALSE(result.truncated);
+        CHECK_EQ(parts[0], "GET");
+        CHECK_EQ(parts[2], "HTTP/1.1");
+
+        std::array<std::string_view, 3> exact{};
+        CHECK_FALSE(strings::split(request_line, ' ').into(exact).truncated);
+        CHECK_EQ(exact[1], "/index.html");
+    }
+
+    SUBCASE("overflow") {
+        std::string_view parts[2];
+        const auto result = strings::split(request_line, ' ').into(parts);
+        CHECK_EQ(result.count, 2);
+        CHECK(result.truncated);
+        CHECK_EQ(parts[1], "/index.html");
+
+        const auto none = strings::split("a", ' ').into(parts, 0);
+        CHECK_EQ(none.count, 0);
+        CHECK(none.truncated);
+    }
+
+    SUBCASE("non bulk-scanning delimiters and predicates") {
+        std::string_view parts[8];
+        const auto result = strings::split("abcdefg", strings::by_length(3)).into(parts);
+        REQUIRE_EQ(result.count, 3);
+        CHECK_EQ(parts[2], "g");
+
+        const auto skipped = strings::rsplit(",a,,b,", ',', strings::skip_empty{}).into(parts);
+        REQUIRE_EQ(skipped.count, 2);
+        CHECK_EQ(parts[0], "b");
+        CHECK_EQ(parts[1], "a");
+    }
+
+    SUBCASE("reuse a container") {
+        std::vector<std::string_view> fields;
+        fields.reserve(8);
+        const auto* storage = fields.data();
+        strings::split(request_line, ' ').into(fields);
+        CHECK_EQ(fields, std::vector<std::string_view>{"GET", "/index.html", "HTTP/1.1"});
+        strings::split("a,b", ',').into(fields);
+        CHECK_EQ(fields, std::vector<std::string_view>{"a", "b"});
+        CHECK_EQ(fields.data(), storage);
+
+        std::vector<std::string> owned;
+        strings::split("x y", ' ').into(owned);
+        CHECK_EQ(owned, std::vector<std::string>{"x", "y"});
+    }
+
+    SUBCASE("visit fields") {
+        std::size_t visited = 0;
+        CHECK_FALSE(strings::split(request_line, ' ').for_each([&visited](std::string_view) {
+            return ++visited < 2;
+        }));
+        CHECK_EQ(visited, 2);
+    }
+}
+
+TEST_CASE("parallel split") {
+    const std::string lines = "alpha\nbeta\n\ngamma\r\ndelta\n\n\nepsilon zeta\n";
+    const std::string repeated = "aaaaaaabaaaabaaaaaaaaab";
+
+    auto check_same = [](std::string_view text, const auto& delim, std::size_t threads) {
+        const auto expected =
+                strings::split(text, delim).template to<std::vector<std::string_view>>();
+        for (std::size_t chunk = 1; chunk <= 8; ++chunk) {
+            CAPTURE(chunk);
+            const auto fields = strings::parallel_split(text, delim, {threads, chunk});
+            CHECK_EQ(fields, expected);
+        }
+    };
+
+    SUBCASE("single-byte delimiters") {
+        for (const std::string_view text : {std::string_view{}, std::string_view{"\n"},
+                                            std::string_view{lines}}) {
+            CAPTURE(text);
+            check_same(text, '\n', 4);
+            check_same(text, strings::by_any_char(" \r\n"), 3);
+        }
+    }
+
+    SUBCASE("multi-byte delimiters straddling chunks") {
+        for (const char* delim : {"aa", "aaa", "ab", "ba", "aab"}) {
+            CAPTURE(delim);
+            check_same(repeated, delim, 5);
+        }
+        check_same(lines, "\r\n", 4);
+    }
+
+    SUBCASE("filter fields") {
+        const auto fields = strings::parallel_split(lines, '\n', strings::skip_empty{}, {4, 4});
+        CHECK_EQ(fields, std::vector<std::string_view>{"alpha", "beta", "gamma\r", "delta",
+                                                       "epsilon zeta"});
+    }
+
+    SUBCASE("default options") {
+        CHECK_EQ(strings::parallel_split(lines, '\n'),
+                 strings::split(lines, '\n').to<std::vector<std::string_view>>());
+    }
+}
+
+TEST_CASE("streaming split") {
+    auto feed_all = [](auto& stream, const std::vector<std::string_view>& chunks) {
+        std::vector<std::string> fields;
+        auto collect = [&fields](std::string_view field) {
+            fields.emplace_back(field);
+            return true;
+        };
+        for (const auto chunk : chunks) {
+            stream.feed(chunk, collect);
+        }
+        stream.finish(collect);
+        return fields;
+    };
+
+    SUBCASE("fields spanning chunks") {
+        strings::split_stream stream('\n');
+        CHECK_EQ(feed_all(stream, {"alp", "ha\nbe", "", "ta\n", "\ngam", "ma"}),
+                 std::vector<std::string>{"alpha", "beta", "", "gamma"});
+        CHECK_EQ(stream.consumed(), 0);
+        CHECK_EQ(feed_all(stream, {"a\n"}), std::vector<std::string>{"a", ""});
+        CHECK_EQ(feed_all(stream, {}), std::vector<std::string>{""});
+    }
+
+    SUBCASE("delimiters spanning chunks") {
+        strings::split_stream stream("\r\n");
+        CHECK_EQ(feed_all(stream, {"GET / HTTP/1.1\r", "\nHost: a\r", "\n\r", "\n"}),
+                 std::vector<std::string>{"GET / HTTP/1.1", "Host: a", "", ""});
+
+        strings::split_stream separator("<=>");
+        CHECK_EQ(feed_all(separator, {"a<", "", "=", ">b<=", "<=>c<", "="}),
+                 std::vector<std::string>{"a", "b<=", "c<="});
+    }
+
+    SUBCASE("bounded memory") {
+        strings::split_stream stream(strings::by_any_char(",;"), strings::skip_empty{});
+        std::size_t count{0};
+        for (int i = 0; i < 1000; ++i) {
+            stream.feed("x,,y;", [&count](std::string_view field) {
+                CHECK_EQ(field.size(), 1);
+                ++count;
+                return true;
+            });
+            CHECK_EQ(stream.pending_size(), 0);
+        }
+        CHECK_EQ(stream.consumed(), 5000);
+        CHECK_FALSE(stream.finish().has_value());
+        CHECK_EQ(count, 2000);
+    }
+
+    SUBCASE("stop early") {
+        strings::split_stream stream(',');
+        CHECK_FALSE(stream.feed("a,b,c", [](std::string_view field) {
+            return field != "b";
+        }));
+        stream.reset();
+        CHECK_EQ(stream.feed("d,e"), std::vector<std::string>{"d"});
+        CHECK_EQ(stream.finish(), "e");
+    }
+}
+
+TEST_CASE("split and trim fields") {
+    const std::string_view config = " name = esl ,\tkind= header-only\t, , empty=  ";
+
+    SUBCASE("keep empty fields") {
+        const auto fields = strings::split(config, ',', strings::trim_fields())
+                                    .to<std::vector<std::string_view>>();
+        CHECK_EQ(fields,
+                 std::vector<std::string_view>{"name = esl", "kind= header-only", "", "empty="});
+
+        // Same as trimming afterwards.
+        std::vector<std::string_view> trimmed;
+        for (const auto field : strings::split(config, ',')) {
+            trimmed.push_back(strings::trim(field, " \t"));
+        }
+        CHECK_EQ(fields, trimmed);
+    }
+
+    SUBCASE("skip empty fields") {
+        const strings::trim_fields trim(" \t", true);
+        CHECK_EQ(strings::split(config, ',', trim).to<std::vector<std::string>>(),
+                 std::vector<std::string>{"name = esl", "kind= header-only", "empty="});
+        CHECK_EQ(strings::rsplit(config, strings::by_any_char(",="), trim)
+                         .to<std::vector<std::string_view>>(),
+                 std::vector<std::string_view>{"empty", "header-only", "kind", "esl", "name"});
+        CHECK_EQ(strings::split(" \t ", ',', trim).count(), 0);
+        CHECK_EQ(strings::split("a |b| c", strings::by_length(2), strings::trim_fields("| ", true))
+                         .to<std::vector<std::string_view>>(),
+                 std::vector<std::string_view>{"a", "b", "c"});
+    }
+
+    SUBCASE("other split modes") {
+        const strings::trim_fields trim(" ", true);
+        CHECK_EQ(strings::parallel_split(" a , b ,, c ", ',', trim, {3, 2}),
+                 std::vector<std::string_view>{"a", "b", "c"});
+
+        strings::split_stream stream(';', trim);
+        CHECK_EQ(stream.feed(" x ; y"), std::vector<std::string>{"x"});
+        CHECK_EQ(stream.feed(" ;  "), std::vector<std::string>{"y"});
+        CHECK_FALSE(stream.finish().has_value());
+    }
+}
+
+TEST_CASE("split by whitespace") {
+    using views = std::vector<std::string_view>;
+
+    SUBCASE("collapse runs") {
+        CHECK_EQ(strings::split("GET  /index.html\t\tHTTP/1.1", strings::by_whitespace{})
+                         .to<views>(),
+                 views{"GET", "/index.html", "HTTP/1.1"});
+        CHECK_EQ(strings::split(" \r\n a \v\f b\n", strings::by_whitespace{}).to<views>(),
+                 views{"", "a", "b", ""});
+        CHECK_EQ(strings::split(" \r\n a \v\f b\n", strings::by_whitespace{}, strings::skip_empty{})
+                         .to<views>(),
+                 views{"a", "b"});
+        CHECK_EQ(strings::split("", strings::by_whitespace{}).to<views>(), views{""});
+        CHECK_EQ(strings::split("   ", strings::by_whitespace{}).to<views>(), views{"", ""});
+    }
+
+    SUBCASE("runs across blocks") {
+        std::string text;
+        views expected;
+        for (std::size_t i = 1; i <= 40; ++i) {
+            text.append(i, 'x');
+            text.append(i % 7 + i % 3 * 30, i % 2 == 0 ? ' ' : '\t');
+        }
+        text.append("end");
+        for (const auto field : strings::split(text, strings::by_any_char(" \t"))) {
+            if (!field.empty()) {
+                expected.push_back(field);
+            }
+        }
+
+        const auto view = strings::split(text, strings::by_whitespace{});
+        CHECK_EQ(view.to<views>(), expected);
+        CHECK_EQ(view.count(), expected.size());
+        CHECK_EQ(static_cast<std::size_t>(std::distance(view.begin(), view.end())),
+                 expected.size());
+
+        auto reversed = strings::rsplit(text, strings::by_whitespace{}).to<views>();
+        std::reverse(reversed.begin(), reversed.end());
+        CHECK_EQ(reversed, expected);
+    }
+
+    SUBCASE("limit splits") {
+        CHECK_EQ(strings::split("a  b \t c", strings::max_splits(strings::by_whitespace{}, 1))
+                         .to<views>(),
+                 views{"a", "b \t c"});
+        CHECK_EQ(strings::rsplit("a  b \t c", strings::max_splits(strings::by_whitespace{}, 1))
+                         .to<views>(),
+                 views{"c", "a  b"});
+    }
+}
+
+TEST_CASE("split lines") {
+    using views = std::vector<std::string_view>;
+
+    SUBCASE("terminators") {
+        CHECK_EQ(strings::lines("a\r\n\nb").to<views>(), views{"a", "", "b"});
+        CHECK_EQ(strings::lines("a\nb\r\n").to<views>(), views{"a", "b"});
+        CHECK_EQ(strings::lines("\r\n").to<views>(), views{""});
+        CHECK_EQ(strings::lines("a\r").to<views>(), views{"a\r"});
+        CHECK_EQ(strings::lines("a\r\r\nb").to<views>(), views{"a\r", "b"});
+        CHECK(strings::lines("").to<views>().empty());
+        CHECK_EQ(strings::lines("").begin(), strings::lines("").end());
+    }
+
+    SUBCASE("iterate, count and visit") {
+        std::string text;
+        views expected;
+        for (int i = 0; i < 100; ++i) {
+            text.append(static_cast<std::size_t>(i), 'x').append(i % 3 == 0 ? "\r\n" : "\n");
+        }
+        for (const auto line : strings::split(text, '\n')) {
+            expected.push_back(strings::trim_suffix(line, "\r"));
+        }
+        expected.pop_back();
+
+        const auto view = strings::lines(text);
+        CHECK_EQ(views(view.begin(), view.end()), expected);
+        CHECK_EQ(view.count(), expected.size());
+        CHECK_EQ(strings::lines(std::string_view(text).substr(0, text.size() - 1)).count(),
+                 expected.size());
+
+        std::size_t visited{0};
+        CHECK_FALSE(view.for_each([&visited](std::string_view line) {
+            ++visited;
+            return line.size() < 10;
+        }));
+        CHECK_EQ(visited, 11);
+
+        esl::small_vector<std::string, 4> owned;
+        strings::lines("x\ny").into(owned);
+        CHECK_EQ(owned, esl::small_vector<std::string, 4>{"x", "y"});
+    }
+}
+
+TEST_CASE("reverse split") {
+    using sv_vec = std::vector<std::string_view>;
+
+    SUBCASE("fields come from the end") {
+        CHECK_EQ(strings::rsplit("a,b,,c", ',').to<sv_vec>(), sv_vec{"c", "", "b", "a"});
+        CHECK_EQ(strings::rsplit("a::b::c", "::").to<sv_vec>(), sv_vec{"c", "b", "a"});
+        CHECK_EQ(strings::rsplit("a:b;c", strings::by_any_char(":;")).to<sv_vec>(),
+                 sv_vec{"c", "b", "a"});
+        CHECK_EQ(strings::rsplit("12345", strings::by_length(2)).to<sv_vec>(),
+                 sv_vec{"45", "23", "1"});
+        CHECK_EQ(strings::rsplit(",a,,b,", ',', strings::skip_empty{}).to<sv_vec>(),
+                 sv_vec{"b", "a"});
+        CHECK_EQ(strings::rsplit("", ',').to<sv_vec>(), sv_vec{""});
+        CHECK_EQ(strings::rsplit(std::string("x/y"), '/').to<std::vector<std::string>>(),
+                 std::vector<std::string>{"y", "x"});
+    }
+
+    SUBCASE("agree with split reversed") {
+        // Long enough to span multiple blocks when scanning backwards.
+        std::string text;
+        for (int i = 0; i < 300; ++i) {
+            text += std::to_string(i * 7919 % 1000);
+            text += i % 3 == 0 ? ";" : ",";
+        }
+        for (std::size_t len = 0; len <= text.size(); len += 37) {
+            const auto str = std::string_view{text}.substr(0, len);
+            auto forward = strings::split(str, ',').to<sv_vec>();
+            std::reverse(forward.begin(), forward.end());
+            CHECK_EQ(strings::rsplit(str, ',').to<sv_vec>(), forward);
+
+            auto any = strings::split(str, strings::by_any_char(",;")).to<sv_vec>();
+            std::reverse(any.begin(), any.end());
+            CHECK_EQ(strings::rsplit(str, strings::by_any_char(",;")).to<sv_vec>(), any);
+        }
+    }
+
+    SUBCASE("index in iteration order") {
+        const auto index = strings::rsplit("a.b.c", '.').index();
+        REQUIRE_EQ(index.size(), 3);
+        CHECK_EQ(index[0], "c");
+        CHECK_EQ(index[2], "a");
+    }
+}
+
+TEST_CASE("split with max splits") {
+    using sv_vec = std::vector<std::string_view>;
+
+    SUBCASE("rest of text is the final field") {
+        CHECK_EQ(strings::split("a,b,c,d", strings::max_splits(',', 2)).to<sv_vec>(),
+                 sv_vec{"a", "b", "c,d"});
+        CHECK_EQ(strings::split("a,b", strings::max_splits(',', 5)).to<sv_vec>(),
+                 sv_vec{"a", "b"});
+        CHECK_EQ(strings::split("a,b", strings::max_splits(',', 0)).to<sv_vec>(), sv_vec{"a,b"});
+        CHECK_EQ(strings::split("k=v=w", strings::max_splits("=", 1)).to<sv_vec>(),
+                 sv_vec{"k", "v=w"});
+        CHECK_EQ(strings::split("123456", strings::max_splits(strings::by_length(2), 1))
+                         .to<sv_vec>(),
+                 sv_vec{"12", "3456"});
+    }
+
+    SUBCASE("bulk scanning agrees with iterators") {
+        const auto view = strings::split("a;b;;c;d", strings::max_splits(';', 3));
+        const sv_vec expected{"a", "b", "", "c;d"};
+        CHECK_EQ(view.to<sv_vec>(), expected);
+        CHECK_EQ(sv_vec(view.begin(), view.end()), expected);
+        CHECK_EQ(view.to<esl::flat_string_vector>(), esl::flat_string_vector{"a", "b", "", "c;d"});
+        CHECK_EQ(view.index().size(), 4);
+    }
+
+    SUBCASE("skipped fields still count") {
+        CHECK_EQ(strings::split(",,a,b", strings::max_splits(',', 2), strings::skip_empty{})
+                         .to<sv_vec>(),
+                 sv_vec{"a,b"});
+    }
+
+    SUBCASE("reverse") {
+        const std::string_view path = "/usr/local/lib/libesl.a";
+        const auto parts = strings::rsplit(path, strings::max_splits('/', 1)).to<sv_vec>();
+        CHECK_EQ(parts, sv_vec{"libesl.a", "/usr/local/lib"});
+        CHECK_EQ(*strings::rsplit("archive.tar.gz", strings::max_splits('.', 1)).begin(), "gz");
+        CHECK_EQ(strings::rsplit("a=b=c", strings::max_splits("=", 1)).to<sv_vec>(),
+                 sv_vec{"c", "a=b"});
+    }
+}
+
 TEST_CASE("split functions") {
     SUBCASE("normal usages") {
         SUBCASE("auto deduce as by_char delimiter") {
@@ -423,6 +1075,28 @@ TEST_CASE("split functions") {
                                .to<std::vector<std::string>>();
             CHECK_EQ(vec, std::vector<std::string>{"foo", "bar", "baz", ""});
         }
+
+        SUBCASE("copies share the text") {
+            auto view = strings::split(std::string(1000, 'x') + "-y", '-');
+            const auto text = view.text();
+            auto copied = view;
+            CHECK_EQ(copied.text().data(), text.data());
+
+            std::vector<std::string_view> fields;
+            {
+                const auto moved = std::move(view);
+                fields = moved.to<std::vector<std::string_view>>();
+                // NOLINTNEXTLINE(bugprone-use-after-move)
+                CHECK(view.text().empty());
+            }
+            // Fields are still valid as `copied` is alive.
+            REQUIRE_EQ(fields.size(), 2);
+            CHECK_EQ(fields[0], std::string(1000, 'x'));
+            CHECK_EQ(fields[1], "y");
+
+            const auto captured = [copied] { return copied.text().size(); };
+            CHECK_EQ(captured(), 1002);
+        }
     }
 
     SUBCASE("specify another predicate") {